@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
+#include "../common/skiplist_common.h"     // Compile with ../common/skiplist_common.c
 
 // Circular Linked List
 struct CNode {
@@ -30,20 +31,24 @@ void insertCircular(struct CNode** head, int data) {
 // Skip List Implementation
 #define MAX_LEVEL 6
 
+// forward[] is stored inside the node (one allocation, no extra hop)
 struct SkipNode {
     int value;
-    struct SkipNode** forward;
+    struct SkipNode* forward[];
 };
 
 struct SkipList {
     int level;
     struct SkipNode* header;
+    SkipNodePool pool;      // Nodes come from this list's own pool
 };
 
-struct SkipNode* createNode(int level, int value) {
-    struct SkipNode* newNode = (struct SkipNode*)malloc(sizeof(struct SkipNode));
+struct SkipNode* createNode(struct SkipList* list, int level, int value) {
+    struct SkipNode* newNode = skipPoolAlloc(&list->pool, level);
+    if (newNode == NULL) {
+        return NULL;
+    }
     newNode->value = value;
-    newNode->forward = (struct SkipNode**)malloc(sizeof(struct SkipNode*) * (level + 1));
     for (int i = 0; i <= level; i++) {
         newNode->forward[i] = NULL;
     }
@@ -52,17 +57,26 @@ struct SkipNode* createNode(int level, int value) {
 
 struct SkipList* createSkipList() {
     struct SkipList* list = (struct SkipList*)malloc(sizeof(struct SkipList));
+    if (list == NULL) {
+        return NULL;
+    }
     list->level = 0;
-    list->header = createNode(MAX_LEVEL, -1);
+    skipPoolInit(&list->pool, sizeof(struct SkipNode), sizeof(struct SkipNode*));
+    list->header = createNode(list, MAX_LEVEL, -1);
+    if (list->header == NULL) {
+        free(list);
+        return NULL;
+    }
     return list;
 }
 
+void destroySkipList(struct SkipList* list) {
+    skipPoolDestroy(&list->pool);   // Every node, header included
+    free(list);
+}
+
 int randomLevel() {
-    int level = 0;
-    while (rand() < RAND_MAX / 2 && level < MAX_LEVEL) {
-        level++;
-    }
-    return level;
+    return skipRandomLevel(MAX_LEVEL, 1);  // P = 0.5, see skiplist_common.c
 }
 
 void skipInsert(struct SkipList* list, int value) {
@@ -88,7 +102,10 @@ void skipInsert(struct SkipList* list, int value) {
             list->level = newLevel;
         }
         
-        struct SkipNode* newNode = createNode(newLevel, value);
+        struct SkipNode* newNode = createNode(list, newLevel, value);
+        if (newNode == NULL) {
+            return;     // Out of memory: list unchanged
+        }
         
         for (int i = 0; i <= newLevel; i++) {
             newNode->forward[i] = update[i]->forward[i];
@@ -97,6 +114,36 @@ void skipInsert(struct SkipList* list, int value) {
     }
 }
 
+// The level is not stored in the node: it is linked on levels
+// 0..level, so count the levels it is unlinked from
+int skipDelete(struct SkipList* list, int value) {
+    struct SkipNode* update[MAX_LEVEL + 1];
+    struct SkipNode* current = list->header;
+
+    for (int i = list->level; i >= 0; i--) {
+        while (current->forward[i] != NULL && current->forward[i]->value < value) {
+            current = current->forward[i];
+        }
+        update[i] = current;
+    }
+
+    current = current->forward[0];
+    if (current == NULL || current->value != value) {
+        return 0;
+    }
+
+    int level = -1;
+    for (int i = 0; i <= list->level && update[i]->forward[i] == current; i++) {
+        update[i]->forward[i] = current->forward[i];
+        level = i;
+    }
+    while (list->level > 0 && list->header->forward[list->level] == NULL) {
+        list->level--;
+    }
+    skipPoolFree(&list->pool, current, level);
+    return 1;
+}
+
 // ...existing code...
 
 // Circular Doubly Linked List
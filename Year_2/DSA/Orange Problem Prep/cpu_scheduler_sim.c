@@ -0,0 +1,856 @@
+/*
+ * CPU SCHEDULER SIMULATOR (discrete-event)
+ * ========================================
+ *
+ * roundRobinScheduling / fcfsScheduling in josephous_cpu_timing.c step
+ * through time one slice at a time, assume every process arrives at 0
+ * and print every slice. Here:
+ *
+ *   - Processes have ARRIVAL times, bursts and priorities
+ *   - Time jumps straight from one EVENT to the next (a process arrives,
+ *     a slice ends), kept in a min-heap ordered by time. Nothing happens
+ *     between events, so there is no per-tick loop and no printing.
+ *   - The scheduling POLICY is a struct of function pointers. The
+ *     simulator only asks it: "here is a ready process", "who runs
+ *     next?", "how long may it run?", "should this arrival preempt?"
+ *
+ * Policies:
+ *   FCFS      first come first served (one FIFO)
+ *   RR        round robin, quantum RR_QUANTUM
+ *   SJF       shortest job first, non-preemptive (heap on burst)
+ *   SRTF      shortest remaining time first, preemptive (heap on remaining)
+ *   PRIORITY  preemptive priority, 0 = most important (heap on priority)
+ *   MLFQ      multi-level feedback queue: 3 FIFOs with growing quanta,
+ *             demote when a quantum is used up, boost everyone to the
+ *             top level every MLFQ_BOOST ticks (O(1): the lists are spliced)
+ *   CFS       like Linux: run the process with the smallest "virtual
+ *             runtime" (kept in a red-black tree); vruntime grows slower
+ *             for more important processes (bigger weight)
+ *
+ * Several CPUs: each CPU has its own run queue holding the policy's
+ * state, and enum Balancing decides how work moves between them (one
+ * shared queue, fixed queues, stealing when idle, periodic balancing).
+ * Running on a different CPU than last time costs MIGRATION_PENALTY.
+ *
+ * Stats: waiting = turnaround - burst, turnaround = finish - arrival,
+ *        response = first time on the CPU - arrival,
+ *        utilization = CPU time spent on bursts / (CPUs * time of the
+ *        last finish); the MIGRATION_PENALTY ticks are busy but not
+ *        useful, so they are reported on their own as migration overhead.
+ *
+ * Compile: gcc -O2 cpu_scheduler_sim.c -o sched -lm
+ * Run:     ./sched [processes] [cpus] [load]        e.g. ./sched 2000000 16 0.9
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <time.h>
+
+#define NO_LIMIT LONG_MAX
+#define RR_QUANTUM 10
+#define MLFQ_LEVELS 3
+#define MLFQ_BOOST 1000
+#define CFS_LATENCY 24          // Every ready process should run once per ~24 ticks
+#define CFS_MIN_SLICE 3
+#define CFS_WAKEUP_GRAN 4       // Arrival preempts if it is this far behind
+#define SHORT_JOB 10            // Bursts up to this count as interactive
+#define MIGRATION_PENALTY 2     // Extra work after moving to another CPU (cold cache)
+#define BALANCE_PERIOD 20       // Ticks between periodic load balancing runs
+
+struct Process {
+    int pid;
+    long arrival;
+    long burst;
+    int priority;               // 0 (most important) .. 9
+
+    // Filled in by the simulation
+    long remaining;
+    long firstRun;              // -1 until it first gets the CPU
+    long finish;
+    int lastCpu;                // -1 until it first runs
+
+    // Policy bookkeeping
+    struct Process* next;               // FIFO queues
+    struct Process *left, *right;       // CFS red-black tree
+    int red;
+    long long vruntime;                 // CFS, in 1/1024 ticks
+    int level, epoch;                   // MLFQ
+};
+
+/*
+ * EVENT HEAP
+ * ----------
+ * When two events happen at the same time, SLICE_END goes first so a
+ * process that finishes exactly when another arrives is not preempted.
+ */
+enum EventType { SLICE_END, ARRIVAL, BALANCE };
+
+struct Event {
+    long time;
+    int type;
+    long version;               // SLICE_END: which dispatch it belongs to
+    struct Process* p;
+    int cpu;                    // SLICE_END: which CPU
+};
+
+struct EventHeap {
+    struct Event* items;
+    int size, capacity;
+};
+
+int eventBefore(struct Event* a, struct Event* b) {
+    return a->time < b->time || (a->time == b->time && a->type < b->type);
+}
+
+void eventPush(struct EventHeap* h, struct Event e) {
+    if (h->size == h->capacity) {
+        h->capacity = h->capacity ? h->capacity * 2 : 16;
+        h->items = realloc(h->items, h->capacity * sizeof(struct Event));
+    }
+    int i = h->size++;
+    while (i > 0 && eventBefore(&e, &h->items[(i - 1) / 2])) {
+        h->items[i] = h->items[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    h->items[i] = e;
+}
+
+int eventPop(struct EventHeap* h, struct Event* out) {
+    if (h->size == 0) return 0;
+    *out = h->items[0];
+    struct Event last = h->items[--h->size];
+    int i = 0;
+    while (2 * i + 1 < h->size) {
+        int child = 2 * i + 1;
+        if (child + 1 < h->size && eventBefore(&h->items[child + 1], &h->items[child])) child++;
+        if (!eventBefore(&h->items[child], &last)) break;
+        h->items[i] = h->items[child];
+        i = child;
+    }
+    h->items[i] = last;
+    return 1;
+}
+
+/*
+ * READY QUEUES USED BY THE POLICIES
+ * ---------------------------------
+ */
+// FIFO through the next pointer (FCFS, RR, MLFQ)
+struct Fifo {
+    struct Process *head, *tail;
+};
+
+void fifoPush(struct Fifo* q, struct Process* p) {
+    p->next = NULL;
+    if (q->tail) q->tail->next = p;
+    else q->head = p;
+    q->tail = p;
+}
+
+struct Process* fifoPop(struct Fifo* q) {
+    struct Process* p = q->head;
+    if (p) {
+        q->head = p->next;
+        if (!q->head) q->tail = NULL;
+    }
+    return p;
+}
+
+// Move all of src to the end of dst in O(1)
+void fifoAppend(struct Fifo* dst, struct Fifo* src) {
+    if (!src->head) return;
+    if (dst->tail) dst->tail->next = src->head;
+    else dst->head = src->head;
+    dst->tail = src->tail;
+    src->head = src->tail = NULL;
+}
+
+// Binary min-heap of processes (SJF, SRTF, PRIORITY)
+struct ReadyHeap {
+    struct Process** items;
+    int size, capacity;
+    int (*before)(struct Process* a, struct Process* b);
+};
+
+void readyPush(struct ReadyHeap* h, struct Process* p) {
+    if (h->size == h->capacity) {
+        h->capacity = h->capacity ? h->capacity * 2 : 16;
+        h->items = realloc(h->items, h->capacity * sizeof(struct Process*));
+    }
+    int i = h->size++;
+    while (i > 0 && h->before(p, h->items[(i - 1) / 2])) {
+        h->items[i] = h->items[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    h->items[i] = p;
+}
+
+struct Process* readyPop(struct ReadyHeap* h) {
+    if (h->size == 0) return NULL;
+    struct Process* top = h->items[0];
+    struct Process* last = h->items[--h->size];
+    int i = 0;
+    while (2 * i + 1 < h->size) {
+        int child = 2 * i + 1;
+        if (child + 1 < h->size && h->before(h->items[child + 1], h->items[child])) child++;
+        if (!h->before(h->items[child], last)) break;
+        h->items[i] = h->items[child];
+        i = child;
+    }
+    h->items[i] = last;
+    return top;
+}
+
+/*
+ * RUN QUEUES AND THE POLICY INTERFACE
+ * -----------------------------------
+ * Every CPU has its own run queue (or they all share queue 0, see
+ * enum Balancing). A policy keeps its state inside the run queue, so
+ * the same policy runs on any number of queues.
+ *
+ * add:      p is ready (new, preempted, or its slice ran out)
+ * pick:     remove and return who runs next (NULL if nobody is ready)
+ * slice:    how long p may run before the policy decides again
+ * charge:   p just ran for `ran` ticks (optional)
+ * expired:  p used its whole slice and still has work (optional)
+ * preempts: should `arrived` take the CPU from `running`? (NULL = never)
+ * moved:    p was taken from one queue to put on another (optional)
+ */
+struct RunQueue {
+    int count;                          // Processes waiting (not running)
+    struct Fifo fifo;                   // FCFS, RR
+    struct ReadyHeap heap;              // SJF, SRTF, PRIORITY
+    struct Fifo levels[MLFQ_LEVELS];    // MLFQ
+    int epoch;
+    long nextBoost;
+    struct Process* cfsRoot;            // CFS
+    long long minVruntime;
+    long totalWeight;
+};
+
+struct Policy {
+    const char* name;
+    void (*reset)(struct RunQueue* rq);
+    void (*add)(struct RunQueue* rq, struct Process* p, long now);
+    struct Process* (*pick)(struct RunQueue* rq, long now);
+    long (*slice)(struct RunQueue* rq, struct Process* p);
+    void (*charge)(struct Process* p, long ran);
+    void (*expired)(struct RunQueue* rq, struct Process* p);
+    int (*preempts)(struct RunQueue* rq, struct Process* running, struct Process* arrived);
+    void (*moved)(struct RunQueue* from, struct RunQueue* to, struct Process* p);
+};
+
+long runToCompletion(struct RunQueue* rq, struct Process* p) {
+    (void)rq; (void)p;
+    return NO_LIMIT;
+}
+
+// ---------- FCFS and RR ----------
+void fifoReset(struct RunQueue* rq) { rq->fifo.head = rq->fifo.tail = NULL; }
+void fifoAdd(struct RunQueue* rq, struct Process* p, long now) { (void)now; fifoPush(&rq->fifo, p); }
+struct Process* fifoPick(struct RunQueue* rq, long now) { (void)now; return fifoPop(&rq->fifo); }
+long rrSlice(struct RunQueue* rq, struct Process* p) { (void)rq; (void)p; return RR_QUANTUM; }
+
+// ---------- SJF, SRTF, PRIORITY ----------
+int shorterBurst(struct Process* a, struct Process* b) {
+    return a->burst < b->burst || (a->burst == b->burst && a->arrival < b->arrival);
+}
+
+int shorterRemaining(struct Process* a, struct Process* b) {
+    return a->remaining < b->remaining || (a->remaining == b->remaining && a->arrival < b->arrival);
+}
+
+int morePriority(struct Process* a, struct Process* b) {
+    return a->priority < b->priority || (a->priority == b->priority && a->arrival < b->arrival);
+}
+
+void sjfReset(struct RunQueue* rq) { rq->heap.size = 0; rq->heap.before = shorterBurst; }
+void srtfReset(struct RunQueue* rq) { rq->heap.size = 0; rq->heap.before = shorterRemaining; }
+void priorityReset(struct RunQueue* rq) { rq->heap.size = 0; rq->heap.before = morePriority; }
+void heapAdd(struct RunQueue* rq, struct Process* p, long now) { (void)now; readyPush(&rq->heap, p); }
+struct Process* heapPick(struct RunQueue* rq, long now) { (void)now; return readyPop(&rq->heap); }
+
+// The running process was charged up to now, so remaining is current
+int srtfPreempts(struct RunQueue* rq, struct Process* running, struct Process* arrived) {
+    (void)rq;
+    return arrived->remaining < running->remaining;
+}
+
+int priorityPreempts(struct RunQueue* rq, struct Process* running, struct Process* arrived) {
+    (void)rq;
+    return arrived->priority < running->priority;
+}
+
+// ---------- MLFQ ----------
+// A boost only bumps the queue's epoch and splices the lower lists onto
+// level 0; a process whose epoch is old is treated as level 0 from then on.
+long mlfqQuantum[MLFQ_LEVELS] = { 8, 32, 128 };
+
+int levelOf(struct RunQueue* rq, struct Process* p) {
+    return p->epoch == rq->epoch ? p->level : 0;
+}
+
+void mlfqReset(struct RunQueue* rq) {
+    memset(rq->levels, 0, sizeof(rq->levels));
+    rq->epoch = 0;
+    rq->nextBoost = MLFQ_BOOST;
+}
+
+void mlfqAdd(struct RunQueue* rq, struct Process* p, long now) {
+    (void)now;
+    p->level = levelOf(rq, p);
+    p->epoch = rq->epoch;
+    fifoPush(&rq->levels[p->level], p);
+}
+
+struct Process* mlfqPick(struct RunQueue* rq, long now) {
+    if (now >= rq->nextBoost) {
+        for (int i = 1; i < MLFQ_LEVELS; i++) fifoAppend(&rq->levels[0], &rq->levels[i]);
+        rq->epoch++;
+        rq->nextBoost = now + MLFQ_BOOST;
+    }
+    for (int i = 0; i < MLFQ_LEVELS; i++) {
+        if (rq->levels[i].head) return fifoPop(&rq->levels[i]);
+    }
+    return NULL;
+}
+
+long mlfqSlice(struct RunQueue* rq, struct Process* p) {
+    return mlfqQuantum[levelOf(rq, p)];
+}
+
+void mlfqExpired(struct RunQueue* rq, struct Process* p) {
+    int level = levelOf(rq, p);
+    p->level = level + 1 < MLFQ_LEVELS ? level + 1 : level;
+    p->epoch = rq->epoch;
+}
+
+int mlfqPreempts(struct RunQueue* rq, struct Process* running, struct Process* arrived) {
+    return levelOf(rq, arrived) < levelOf(rq, running);
+}
+
+// Keep the level it had on the old queue
+void mlfqMoved(struct RunQueue* from, struct RunQueue* to, struct Process* p) {
+    p->level = levelOf(from, p);
+    p->epoch = to->epoch;
+}
+
+// ---------- CFS ----------
+// Left-leaning red-black tree ordered by (vruntime, pid); only insert
+// and delete-minimum are needed.
+// Weight from priority like Linux nice values: each step is ~1.25x.
+long weightOf(struct Process* p) {
+    static const long weights[10] = { 3121, 2501, 1991, 1586, 1277, 1024, 820, 655, 526, 423 };
+    return weights[p->priority];
+}
+
+int cfsBefore(struct Process* a, struct Process* b) {
+    return a->vruntime < b->vruntime || (a->vruntime == b->vruntime && a->pid < b->pid);
+}
+
+int isRed(struct Process* h) {
+    return h != NULL && h->red;
+}
+
+struct Process* rotateLeft(struct Process* h) {
+    struct Process* x = h->right;
+    h->right = x->left;
+    x->left = h;
+    x->red = h->red;
+    h->red = 1;
+    return x;
+}
+
+struct Process* rotateRight(struct Process* h) {
+    struct Process* x = h->left;
+    h->left = x->right;
+    x->right = h;
+    x->red = h->red;
+    h->red = 1;
+    return x;
+}
+
+void flipColors(struct Process* h) {
+    h->red = !h->red;
+    h->left->red = !h->left->red;
+    h->right->red = !h->right->red;
+}
+
+struct Process* fixUp(struct Process* h) {
+    if (isRed(h->right) && !isRed(h->left)) h = rotateLeft(h);
+    if (isRed(h->left) && isRed(h->left->left)) h = rotateRight(h);
+    if (isRed(h->left) && isRed(h->right)) flipColors(h);
+    return h;
+}
+
+struct Process* treeInsert(struct Process* h, struct Process* p) {
+    if (h == NULL) {
+        p->left = p->right = NULL;
+        p->red = 1;
+        return p;
+    }
+    if (cfsBefore(p, h)) h->left = treeInsert(h->left, p);
+    else h->right = treeInsert(h->right, p);
+    return fixUp(h);
+}
+
+struct Process* moveRedLeft(struct Process* h) {
+    flipColors(h);
+    if (isRed(h->right->left)) {
+        h->right = rotateRight(h->right);
+        h = rotateLeft(h);
+        flipColors(h);
+    }
+    return h;
+}
+
+struct Process* treeDeleteMin(struct Process* h, struct Process** min) {
+    if (h->left == NULL) {
+        *min = h;
+        return NULL;
+    }
+    if (!isRed(h->left) && !isRed(h->left->left)) h = moveRedLeft(h);
+    h->left = treeDeleteMin(h->left, min);
+    return fixUp(h);
+}
+
+void cfsReset(struct RunQueue* rq) {
+    rq->cfsRoot = NULL;
+    rq->minVruntime = 0;
+    rq->totalWeight = 0;
+}
+
+void cfsAdd(struct RunQueue* rq, struct Process* p, long now) {
+    (void)now;
+    // A new process starts level with the others instead of at 0,
+    // otherwise it would own the CPU until it caught up
+    if (p->vruntime < rq->minVruntime) p->vruntime = rq->minVruntime;
+    rq->cfsRoot = treeInsert(rq->cfsRoot, p);
+    rq->cfsRoot->red = 0;
+    rq->totalWeight += weightOf(p);
+}
+
+struct Process* cfsPick(struct RunQueue* rq, long now) {
+    (void)now;
+    if (rq->cfsRoot == NULL) return NULL;
+    struct Process* p;
+    if (!isRed(rq->cfsRoot->left) && !isRed(rq->cfsRoot->right)) rq->cfsRoot->red = 1;
+    rq->cfsRoot = treeDeleteMin(rq->cfsRoot, &p);
+    if (rq->cfsRoot) rq->cfsRoot->red = 0;
+    rq->totalWeight -= weightOf(p);
+    if (p->vruntime > rq->minVruntime) rq->minVruntime = p->vruntime;
+    return p;
+}
+
+// Share of CFS_LATENCY in proportion to weight
+long cfsSlice(struct RunQueue* rq, struct Process* p) {
+    long w = weightOf(p);
+    long slice = CFS_LATENCY * w / (rq->totalWeight + w);
+    return slice < CFS_MIN_SLICE ? CFS_MIN_SLICE : slice;
+}
+
+void cfsCharge(struct Process* p, long ran) {
+    p->vruntime += (long long)ran * 1024 * 1024 / weightOf(p);
+}
+
+int cfsPreempts(struct RunQueue* rq, struct Process* running, struct Process* arrived) {
+    (void)rq;
+    return running->vruntime - arrived->vruntime > (long long)CFS_WAKEUP_GRAN * 1024;
+}
+
+// vruntime only means something relative to its queue (like Linux does)
+void cfsMoved(struct RunQueue* from, struct RunQueue* to, struct Process* p) {
+    p->vruntime += to->minVruntime - from->minVruntime;
+}
+
+struct Policy policies[] = {
+    { "FCFS",     fifoReset,     fifoAdd, fifoPick, runToCompletion, NULL,      NULL,        NULL,             NULL },
+    { "RR",       fifoReset,     fifoAdd, fifoPick, rrSlice,         NULL,      NULL,        NULL,             NULL },
+    { "SJF",      sjfReset,      heapAdd, heapPick, runToCompletion, NULL,      NULL,        NULL,             NULL },
+    { "SRTF",     srtfReset,     heapAdd, heapPick, runToCompletion, NULL,      NULL,        srtfPreempts,     NULL },
+    { "PRIORITY", priorityReset, heapAdd, heapPick, runToCompletion, NULL,      NULL,        priorityPreempts, NULL },
+    { "MLFQ",     mlfqReset,     mlfqAdd, mlfqPick, mlfqSlice,       NULL,      mlfqExpired, mlfqPreempts,     mlfqMoved },
+    { "CFS",      cfsReset,      cfsAdd,  cfsPick,  cfsSlice,        cfsCharge, NULL,        cfsPreempts,      cfsMoved },
+};
+#define POLICY_COUNT (int)(sizeof(policies) / sizeof(policies[0]))
+
+/*
+ * SPREADING WORK OVER CPUS
+ * ------------------------
+ * GLOBAL_QUEUE    one run queue shared by all CPUs (like the original
+ *                 round robin): perfectly balanced, but a process keeps
+ *                 landing on a different CPU
+ * PER_CPU         arrivals are dealt round robin to per-CPU queues and
+ *                 never move: no migrations, but one CPU can sit idle
+ *                 while another has a backlog
+ * IDLE_STEAL      per-CPU, and a CPU with nothing to run steals from
+ *                 the longest queue
+ * STEAL_BALANCE   IDLE_STEAL plus a balancer every BALANCE_PERIOD ticks
+ *                 that evens out queue lengths
+ *
+ * Cache affinity: a process that runs on a different CPU than last time
+ * finds a cold cache and needs MIGRATION_PENALTY extra ticks of work.
+ */
+enum Balancing { GLOBAL_QUEUE, PER_CPU, IDLE_STEAL, STEAL_BALANCE };
+const char* balancingNames[] = { "global queue", "per-CPU", "idle steal", "steal+balance" };
+
+struct Cpu {
+    struct Process* running;
+    long runStart;
+    long version;               // Bumped on every dispatch
+    long busy;                  // Ticks spent running processes
+};
+
+struct Stats {
+    double avgWaiting, avgTurnaround, avgResponse;
+    double shortTurnaround;     // Average turnaround of jobs with burst <= SHORT_JOB
+    long p99Response, p999Response, p99Turnaround, maxWaiting;
+    long switches;              // Dispatches
+    long migrations;            // Dispatches on a different CPU than last time
+    double utilization;         // Useful CPU time / (CPUs * time until the last finish)
+    double migrationOverhead;   // Penalty ticks / (CPUs * time until the last finish)
+    double seconds;             // Real time the simulation took
+};
+
+struct Sim {
+    struct Policy* policy;
+    enum Balancing balancing;
+    int cpuCount;
+    struct Cpu* cpus;
+    struct RunQueue* queues;
+    int queueCount;
+    long switches, migrations;
+};
+
+struct RunQueue* queueOf(struct Sim* sim, int cpu) {
+    return &sim->queues[sim->balancing == GLOBAL_QUEUE ? 0 : cpu];
+}
+
+void enqueueReady(struct Sim* sim, struct RunQueue* rq, struct Process* p, long now) {
+    sim->policy->add(rq, p, now);
+    rq->count++;
+}
+
+struct Process* dequeueReady(struct Sim* sim, struct RunQueue* rq, long now) {
+    struct Process* p = sim->policy->pick(rq, now);
+    if (p) rq->count--;
+    return p;
+}
+
+struct RunQueue* longestQueue(struct Sim* sim) {
+    struct RunQueue* longest = &sim->queues[0];
+    for (int i = 1; i < sim->queueCount; i++) {
+        if (sim->queues[i].count > longest->count) longest = &sim->queues[i];
+    }
+    return longest;
+}
+
+// Take the next process of `from` and queue it on `to`
+struct Process* moveOne(struct Sim* sim, struct RunQueue* from, struct RunQueue* to, long now) {
+    struct Process* p = dequeueReady(sim, from, now);
+    if (p && sim->policy->moved) sim->policy->moved(from, to, p);
+    return p;
+}
+
+// Periodic balancing: move from the longest to the shortest queue until
+// they differ by at most one
+void balanceQueues(struct Sim* sim, long now) {
+    for (int moves = 0; moves < sim->queueCount * 4; moves++) {
+        struct RunQueue* longest = longestQueue(sim);
+        struct RunQueue* shortest = &sim->queues[0];
+        for (int i = 1; i < sim->queueCount; i++) {
+            if (sim->queues[i].count < shortest->count) shortest = &sim->queues[i];
+        }
+        if (longest->count - shortest->count <= 1) break;
+        enqueueReady(sim, shortest, moveOne(sim, longest, shortest, now), now);
+    }
+}
+
+// Account the time the running process spent on the CPU up to now
+void chargeRunning(struct Sim* sim, struct Cpu* cpu, long now) {
+    long ran = now - cpu->runStart;
+    cpu->running->remaining -= ran;
+    cpu->busy += ran;
+    if (sim->policy->charge) sim->policy->charge(cpu->running, ran);
+    cpu->runStart = now;
+}
+
+void dispatch(struct Sim* sim, int c, struct EventHeap* events, long now) {
+    struct Cpu* cpu = &sim->cpus[c];
+    struct RunQueue* rq = queueOf(sim, c);
+    struct Process* p = dequeueReady(sim, rq, now);
+    if (p == NULL && sim->balancing >= IDLE_STEAL) {
+        struct RunQueue* victim = longestQueue(sim);
+        if (victim->count > 0) p = moveOne(sim, victim, rq, now);
+    }
+    if (p == NULL) return;
+
+    if (p->lastCpu >= 0 && p->lastCpu != c) {
+        p->remaining += MIGRATION_PENALTY;
+        sim->migrations++;
+    }
+    p->lastCpu = c;
+    if (p->firstRun < 0) p->firstRun = now;
+    long slice = sim->policy->slice(rq, p);
+    if (slice > p->remaining) slice = p->remaining;
+    cpu->running = p;
+    cpu->runStart = now;
+    sim->switches++;
+    eventPush(events, (struct Event){ now + slice, SLICE_END, ++cpu->version, p, c });
+}
+
+int compareLong(const void* a, const void* b) {
+    long x = *(const long*)a, y = *(const long*)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * THE SIMULATOR
+ * -------------
+ * Only the next arrival is in the event heap at any time (processes are
+ * sorted by arrival), plus the end of each CPU's current slice and the
+ * next balancing tick.
+ * A preempted slice's SLICE_END stays in the heap; its version no
+ * longer matches the CPU's current dispatch, so it is ignored when popped.
+ */
+void simulate(struct Process procs[], int n, struct Policy* policy, enum Balancing balancing,
+              int cpuCount, struct Stats* stats) {
+    if (n <= 0) {
+        memset(stats, 0, sizeof(*stats));   // Nothing to schedule (and no percentiles to take)
+        return;
+    }
+    double start = (double)clock() / CLOCKS_PER_SEC;
+    for (int i = 0; i < n; i++) {
+        procs[i].remaining = procs[i].burst;
+        procs[i].firstRun = -1;
+        procs[i].vruntime = 0;
+        procs[i].level = 0;
+        procs[i].epoch = -1;
+        procs[i].lastCpu = -1;
+    }
+
+    struct Sim sim = { policy, balancing, cpuCount, NULL, NULL, 0, 0, 0 };
+    sim.queueCount = balancing == GLOBAL_QUEUE ? 1 : cpuCount;
+    sim.cpus = calloc(cpuCount, sizeof(struct Cpu));
+    sim.queues = calloc(sim.queueCount, sizeof(struct RunQueue));
+    for (int i = 0; i < sim.queueCount; i++) policy->reset(&sim.queues[i]);
+
+    struct EventHeap events = { NULL, 0, 0 };
+    int nextArrival = 0, finished = 0, nextQueue = 0;
+    long lastFinish = 0;
+    if (n > 0) {
+        eventPush(&events, (struct Event){ procs[0].arrival, ARRIVAL, 0, &procs[0], 0 });
+        nextArrival = 1;
+    }
+    if (balancing == STEAL_BALANCE) eventPush(&events, (struct Event){ BALANCE_PERIOD, BALANCE, 0, NULL, 0 });
+
+    struct Event e;
+    while (eventPop(&events, &e)) {
+        long now = e.time;
+        if (e.type == ARRIVAL) {
+            if (nextArrival < n) {
+                struct Process* p = &procs[nextArrival++];
+                eventPush(&events, (struct Event){ p->arrival, ARRIVAL, 0, p, 0 });
+            }
+            struct RunQueue* rq = &sim.queues[nextQueue];
+            nextQueue = (nextQueue + 1) % sim.queueCount;
+            enqueueReady(&sim, rq, e.p, now);
+
+            // May preempt one of the CPUs that serve this queue: none if
+            // one of them is idle (it takes the arrival below), else the
+            // one running the process the policy ranks worst. x is worse
+            // than y when y would preempt x.
+            int victim = -1, idle = 0;
+            for (int c = 0; policy->preempts && c < cpuCount; c++) {
+                struct Cpu* cpu = &sim.cpus[c];
+                if (queueOf(&sim, c) != rq) continue;
+                if (cpu->running == NULL) {
+                    idle = 1;
+                    break;
+                }
+                chargeRunning(&sim, cpu, now);
+                if (victim < 0 || policy->preempts(rq, cpu->running, sim.cpus[victim].running)) victim = c;
+            }
+            if (!idle && victim >= 0 && policy->preempts(rq, sim.cpus[victim].running, e.p)) {
+                enqueueReady(&sim, rq, sim.cpus[victim].running, now);
+                sim.cpus[victim].running = NULL;
+            }
+        } else if (e.type == SLICE_END) {
+            struct Cpu* cpu = &sim.cpus[e.cpu];
+            if (cpu->running == NULL || e.version != cpu->version) continue;   // Preempted earlier
+            chargeRunning(&sim, cpu, now);
+            if (cpu->running->remaining == 0) {
+                cpu->running->finish = now;
+                lastFinish = now;
+                finished++;
+            } else {
+                struct RunQueue* rq = queueOf(&sim, e.cpu);
+                if (policy->expired) policy->expired(rq, cpu->running);
+                enqueueReady(&sim, rq, cpu->running, now);
+            }
+            cpu->running = NULL;
+        } else {
+            balanceQueues(&sim, now);
+            if (finished < n) eventPush(&events, (struct Event){ now + BALANCE_PERIOD, BALANCE, 0, NULL, 0 });
+        }
+
+        for (int c = 0; c < cpuCount; c++) {
+            if (sim.cpus[c].running == NULL) dispatch(&sim, c, &events, now);
+        }
+    }
+    free(events.items);
+
+    // Statistics
+    long* responses = malloc(n * sizeof(long));
+    long* turnarounds = malloc(n * sizeof(long));
+    double waiting = 0, turnaround = 0, response = 0, shortSum = 0;
+    long shortCount = 0, maxWaiting = 0, busy = 0;
+    for (int i = 0; i < n; i++) {
+        long t = procs[i].finish - procs[i].arrival;
+        long w = t - procs[i].burst;
+        responses[i] = procs[i].firstRun - procs[i].arrival;
+        turnarounds[i] = t;
+        turnaround += t;
+        waiting += w;
+        response += responses[i];
+        if (w > maxWaiting) maxWaiting = w;
+        if (procs[i].burst <= SHORT_JOB) {
+            shortSum += t;
+            shortCount++;
+        }
+    }
+    for (int c = 0; c < cpuCount; c++) busy += sim.cpus[c].busy;
+    qsort(responses, n, sizeof(long), compareLong);
+    qsort(turnarounds, n, sizeof(long), compareLong);
+    stats->avgWaiting = waiting / n;
+    stats->avgTurnaround = turnaround / n;
+    stats->avgResponse = response / n;
+    stats->shortTurnaround = shortCount ? shortSum / shortCount : 0;
+    stats->p99Response = responses[(long)n * 99 / 100];
+    stats->p999Response = responses[(long)n * 999 / 1000];
+    stats->p99Turnaround = turnarounds[(long)n * 99 / 100];
+    stats->maxWaiting = maxWaiting;
+    stats->switches = sim.switches;
+    stats->migrations = sim.migrations;
+    // Every penalty tick is worked off before its process finishes
+    long penalty = sim.migrations * MIGRATION_PENALTY;
+    double capacity = (double)cpuCount * lastFinish;
+    stats->utilization = lastFinish ? (busy - penalty) / capacity : 0;
+    stats->migrationOverhead = lastFinish ? penalty / capacity : 0;
+    free(responses);
+    free(turnarounds);
+    for (int i = 0; i < sim.queueCount; i++) free(sim.queues[i].heap.items);
+    free(sim.queues);
+    free(sim.cpus);
+    stats->seconds = (double)clock() / CLOCKS_PER_SEC - start;
+}
+
+/*
+ * WORKLOAD
+ * --------
+ * Arrivals are random (exponential gaps, a Poisson process).
+ * 70% interactive jobs of 1..10 ticks, 30% CPU-bound jobs of 20..400.
+ * load = average fraction of time each CPU is busy.
+ */
+unsigned int seed = 2463534242u;
+
+unsigned int nextRandom() {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+double uniform01() {
+    return (nextRandom() + 0.5) / 4294967296.0;
+}
+
+void generateWorkload(struct Process procs[], int n, double load, int cpuCount) {
+    double meanBurst = 0.7 * 5.5 + 0.3 * 210;
+    double meanGap = meanBurst / (load * cpuCount);
+    double arrivalTime = 0;
+    for (int i = 0; i < n; i++) {
+        arrivalTime += -meanGap * log(uniform01());
+        procs[i].pid = i + 1;
+        procs[i].arrival = (long)arrivalTime;
+        procs[i].burst = nextRandom() % 10 < 7 ? 1 + nextRandom() % 10 : 20 + nextRandom() % 381;
+        procs[i].priority = nextRandom() % 10;
+    }
+}
+
+void printStatsHeader() {
+    printf("Policy   | avg wait | avg turnaround | short-job turnaround | avg response | p99 response | max wait | switches | sim ms\n");
+    printf("---------+----------+----------------+----------------------+--------------+--------------+----------+----------+-------\n");
+}
+
+void printStats(const char* name, struct Stats* s) {
+    printf("%-8s | %8.1f | %14.1f | %20.1f | %12.1f | %12ld | %8ld | %8ld | %6.0f\n", name,
+           s->avgWaiting, s->avgTurnaround, s->shortTurnaround, s->avgResponse,
+           s->p99Response, s->maxWaiting, s->switches, s->seconds * 1e3);
+}
+
+void printMulticoreHeader() {
+    printf("Policy   | Balancing     | util %% | migrations | migration overhead %% | avg turnaround | p99 turnaround | p99 response | p99.9 response | sim ms\n");
+    printf("---------+---------------+--------+------------+----------------------+----------------+----------------+--------------+----------------+-------\n");
+}
+
+void printMulticore(const char* name, enum Balancing b, struct Stats* s) {
+    printf("%-8s | %-13s | %6.1f | %10ld | %20.1f | %14.1f | %14ld | %12ld | %14ld | %6.0f\n", name, balancingNames[b],
+           s->utilization * 100, s->migrations, s->migrationOverhead * 100, s->avgTurnaround, s->p99Turnaround,
+           s->p99Response, s->p999Response, s->seconds * 1e3);
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 500000;
+    int cpuCount = argc > 2 ? atoi(argv[2]) : 8;
+    double load = argc > 3 ? atof(argv[3]) : 0.9;
+    if (n < 0) n = 0;
+    if (cpuCount < 1) cpuCount = 1;
+
+    // Small textbook example (arrival, burst, priority) so results can be checked by hand
+    struct Process example[] = {
+        { .pid = 1, .arrival = 0, .burst = 8, .priority = 3 },
+        { .pid = 2, .arrival = 1, .burst = 4, .priority = 1 },
+        { .pid = 3, .arrival = 2, .burst = 9, .priority = 4 },
+        { .pid = 4, .arrival = 3, .burst = 5, .priority = 2 },
+    };
+    printf("Example: P1(0, 8) P2(1, 4) P3(2, 9) P4(3, 5)   (arrival, burst)\n");
+    for (int k = 0; k < POLICY_COUNT; k++) {
+        struct Stats s;
+        simulate(example, 4, &policies[k], GLOBAL_QUEUE, 1, &s);
+        printf("%-8s finish:", policies[k].name);
+        for (int i = 0; i < 4; i++) printf(" P%d=%-3ld", example[i].pid, example[i].finish);
+        printf(" avg wait %.2f, avg turnaround %.2f\n", s.avgWaiting, s.avgTurnaround);
+    }
+
+    struct Process* procs = malloc(n * sizeof(struct Process));
+    generateWorkload(procs, n, load, 1);
+    printf("\nOne CPU: %d processes, load %.2f, times in ticks\n", n, load);
+    printStatsHeader();
+    for (int k = 0; k < POLICY_COUNT; k++) {
+        struct Stats s;
+        simulate(procs, n, &policies[k], GLOBAL_QUEUE, 1, &s);
+        printStats(policies[k].name, &s);
+    }
+
+    if (cpuCount > 1) {
+        seed = 2463534242u;
+        generateWorkload(procs, n, load, cpuCount);
+        printf("\n%d CPUs: %d processes, load %.2f per CPU, migration penalty %d ticks\n",
+               cpuCount, n, load, MIGRATION_PENALTY);
+        printMulticoreHeader();
+        for (int k = 0; k < POLICY_COUNT; k++) {
+            for (int b = GLOBAL_QUEUE; b <= STEAL_BALANCE; b++) {
+                struct Stats s;
+                simulate(procs, n, &policies[k], b, cpuCount, &s);
+                printMulticore(policies[k].name, b, &s);
+            }
+        }
+    }
+
+    free(procs);
+    return 0;
+}
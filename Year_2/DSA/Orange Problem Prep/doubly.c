@@ -20,7 +20,7 @@ void insertBeginning(struct DNode** head, int data) {
     *head = newNode;
 }
 
-// Insert at end
+// Insert at end (walks the whole list: O(n); list_handle.c keeps a tail for O(1))
 void insertEnd(struct DNode** head, int data) {
     struct DNode* newNode = (struct DNode*)malloc(sizeof(struct DNode));
     newNode->data = data;
@@ -12,6 +12,33 @@ struct Queue {
     int front, rear;
 };
 
+// Circular, because round robin puts unfinished processes back in
+void initQueue(struct Queue* q) {
+    q->front = 0;
+    q->rear = -1;
+}
+
+int isEmpty(struct Queue* q) {
+    return q->rear < q->front;
+}
+
+void enqueue(struct Queue* q, int value) {
+    if (q->rear - q->front + 1 == SIZE) {
+        printf("Queue is full\n");
+        return;
+    }
+    q->rear++;
+    q->items[q->rear % SIZE] = value;
+}
+
+int dequeue(struct Queue* q) {
+    if (isEmpty(q)) {
+        printf("Queue is empty\n");
+        return -1;
+    }
+    return q->items[q->front++ % SIZE];
+}
+
 
 // Josephus using iterative approach
 int josephusIterative(int n, int k) {
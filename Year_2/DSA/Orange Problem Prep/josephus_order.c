@@ -0,0 +1,207 @@
+/*
+ * JOSEPHUS: ELIMINATION ORDER AND SURVIVOR FOR HUGE n
+ * ===================================================
+ *
+ * n people stand in a circle (1..n), counting starts at person 1, and
+ * every k-th person is removed.
+ *
+ * 1. Elimination order in O(n log n): FENWICK TREE
+ *    Simulating on a circular linked list (csll.c) walks k-1 nodes per
+ *    removal: O(nk). Instead keep a Fenwick (binary indexed) tree with
+ *    a 1 for every person still standing. If the next victim is the
+ *    r-th person still standing, "find the r-th 1" takes O(log n) by
+ *    walking down the tree's powers of two, and so does removing it.
+ *
+ * 2. Survivor in O(n): the recurrence J(i) = (J(i-1) + k) mod i
+ *    (josephusIterative in josephous_cpu_timing.c).
+ *
+ * 3. Survivor in O(k log n) for small k and n up to 10^18:
+ *    One full trip round the circle removes n/k people at once. Solve
+ *    the smaller circle of n - n/k people, then map its answer back to
+ *    a position in the big circle. Each step shrinks n by a factor
+ *    (1 - 1/k), so there are about k ln n steps. Done with an explicit
+ *    stack of n values instead of recursion.
+ *
+ * Compile: gcc -O2 josephus_order.c -o josephus
+ * Run:     ./josephus [maxN] [k]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// ---------------- Elimination order with a Fenwick tree ----------------
+// order[0..n-1] receives the people in the order they leave (1-based);
+// the last entry is the survivor
+void eliminationOrder(int n, int k, int order[]) {
+    int* tree = malloc((n + 1) * sizeof(int));
+
+    // Build with every person present in O(n): each node covers i & -i people
+    for (int i = 1; i <= n; i++) tree[i] = i & -i;
+
+    int topBit = 1;
+    while (topBit * 2 <= n) topBit *= 2;
+
+    int rank = 0;           // 0-based rank (among those left) where counting starts
+    for (int left = n; left > 0; left--) {
+        rank = (int)((rank + (long long)k - 1) % left);
+
+        // Find the person with exactly rank+1 people standing up to and including them
+        int pos = 0, need = rank + 1;
+        for (int step = topBit; step > 0; step >>= 1) {
+            if (pos + step <= n && tree[pos + step] < need) {
+                pos += step;
+                need -= tree[pos];
+            }
+        }
+        pos++;
+
+        order[n - left] = pos;
+        for (int i = pos; i <= n; i += i & -i) tree[i]--;
+        // The next count starts at the same rank (everyone after moved down one)
+    }
+    free(tree);
+}
+
+// ---------------- Survivor, O(n) ----------------
+long long survivorLinear(long long n, long long k) {
+    long long result = 0;
+    for (long long i = 2; i <= n; i++) result = (result + k) % i;
+    return result + 1;
+}
+
+// ---------------- Survivor, O(k log n) ----------------
+long long survivorFast(long long n, long long k) {
+    if (k == 1) return n;
+
+    // Going down: n -> n - n/k until the circle is smaller than k
+    int capacity = 64, depth = 0;
+    long long* sizes = malloc(capacity * sizeof(long long));
+    while (n >= k) {
+        if (depth == capacity) {
+            capacity *= 2;
+            sizes = realloc(sizes, capacity * sizeof(long long));
+        }
+        sizes[depth++] = n;
+        n -= n / k;
+    }
+
+    // Small circle (n < k): plain recurrence
+    long long result = 0;
+    for (long long i = 2; i <= n; i++) result = (result + k) % i;
+
+    // Coming back up: map the answer for m - m/k people to m people.
+    // After one trip the count restarts just after the last removed
+    // person (position m/k * k), and m % k people sit after it.
+    while (depth > 0) {
+        long long m = sizes[--depth];
+        result -= m % k;
+        if (result < 0) result += m;                // Lands among the last m % k people
+        else result += result / (k - 1);            // Skip the removed every k-th
+    }
+    free(sizes);
+    return result + 1;
+}
+
+// ---------------- Baseline: csll.c circular list ----------------
+struct Node {
+    int data;
+    struct Node* next;
+};
+
+// csll.c's insert_end
+void insert_end(struct Node** tail, int val) {
+    struct Node* newnode = malloc(sizeof(struct Node));
+    newnode->data = val;
+    if (*tail == NULL) {
+        newnode->next = newnode;
+        *tail = newnode;
+    } else {
+        newnode->next = (*tail)->next;
+        (*tail)->next = newnode;
+        *tail = newnode;
+    }
+}
+
+// Walk k-1 nodes, unlink the next one: O(k) per removal
+void eliminationOrderList(int n, int k, int order[]) {
+    struct Node* tail = NULL;
+    for (int i = 1; i <= n; i++) insert_end(&tail, i);
+
+    struct Node* prev = tail;
+    for (int out = 0; out < n; out++) {
+        for (int s = 1; s < k; s++) prev = prev->next;
+        struct Node* victim = prev->next;
+        order[out] = victim->data;
+        prev->next = victim->next;
+        free(victim);
+    }
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[]) {
+    int maxN = argc > 1 ? atoi(argv[1]) : 10000000;
+    int k = argc > 2 ? atoi(argv[2]) : 3;
+    if (k < 1) k = 1;
+
+    int demo[7];
+    eliminationOrder(7, 3, demo);
+    printf("n = 7, k = 3, elimination order:");
+    for (int i = 0; i < 7; i++) printf(" %d", demo[i]);
+    printf("  (survivor %lld)\n\n", survivorFast(7, 3));
+
+    // The list does n*k steps, so it is skipped once that gets too big
+    printf("Elimination order (ms)\n");
+    printf("        n |     k | circular list | Fenwick | Same\n");
+    printf("----------+-------+---------------+---------+-----\n");
+    int orderKs[] = { k, 100, 10000 };
+    for (int q = 0; q < 3; q++) {
+        for (int n = 1000; n <= maxN; n *= 10) {
+            int* a = malloc(n * sizeof(int));
+            int* b = malloc(n * sizeof(int));
+            double t = nowSeconds();
+            eliminationOrder(n, orderKs[q], b);
+            double fenwick = nowSeconds() - t;
+            if ((long long)n * orderKs[q] <= 200000000LL) {
+                t = nowSeconds();
+                eliminationOrderList(n, orderKs[q], a);
+                double list = nowSeconds() - t;
+                int same = 1;
+                for (int i = 0; i < n; i++) if (a[i] != b[i]) same = 0;
+                printf("%9d | %5d | %13.1f | %7.1f | %s\n", n, orderKs[q], list * 1e3, fenwick * 1e3, same ? "yes" : "NO");
+            } else {
+                printf("%9d | %5d | %13s | %7.1f |\n", n, orderKs[q], "skipped", fenwick * 1e3);
+            }
+            free(a);
+            free(b);
+            if (n < maxN && n * 10LL > maxN) n = maxN / 10;   // end exactly at maxN
+        }
+    }
+
+    printf("\nSurvivor only\n");
+    printf("                   n |     k | O(n) ms  | O(k log n) us | survivor\n");
+    printf("---------------------+-------+----------+---------------+---------------------\n");
+    long long ns[] = { 1000000LL, 100000000LL, 1000000000000LL, 1000000000000000000LL };
+    long long ks[] = { 2, 3, 1000 };
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 3; j++) {
+            double t = nowSeconds();
+            long long fast = survivorFast(ns[i], ks[j]);
+            double fastTime = nowSeconds() - t;
+            char linearText[32] = "skipped";
+            if (ns[i] <= 100000000LL) {
+                t = nowSeconds();
+                long long linear = survivorLinear(ns[i], ks[j]);
+                snprintf(linearText, sizeof(linearText), "%.0f%s", (nowSeconds() - t) * 1e3,
+                         linear == fast ? "" : " DIFF");
+            }
+            printf("%20lld | %5lld | %8s | %13.1f | %lld\n", ns[i], ks[j], linearText, fastTime * 1e6, fast);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,318 @@
+/*
+ * LIST HANDLES: O(1) APPEND AND BULK LOAD
+ * =======================================
+ *
+ * insertEnd in singly.c / doubly.c (and insert_end in sll_insertion.c,
+ * addnode in U3-P9-linkList.c) walks from head to the
+ * last node on every append, so building an n element list costs
+ * 1 + 2 + ... + n = O(n^2) steps.
+ *
+ * A HANDLE keeps head, tail and size together:
+ *   - append: link after tail, move tail. O(1)
+ *   - size:   read the field instead of counting. O(1)
+ *
+ * The nodes also come from blocks the handle owns instead of one malloc
+ * each:
+ *   - listHandleAppendArray(list, a, n) gets all n nodes with ONE allocation
+ *     and links them in a single pass
+ *   - single appends take the next free slot of the current block
+ *     (blocks double in size up to BLOCK_MAX nodes)
+ *   - listHandleFree frees the blocks, not every node
+ * Because of that, nodes of a handle must NOT be free()d one by one
+ * (deleteNode in singly.c would do that). Read-only helpers such as
+ * findMiddle or findPairs work on list.head as usual.
+ *
+ * The structs are the same as singly.c (struct Node) and doubly.c
+ * (struct DNode); both handles share one block allocator (NodeBlocks)
+ * that only needs the node size. The names stay clear of
+ * Unit_1/intrusive_list.h (SList/DList, dlistInit, ...).
+ *
+ * Compile: gcc -O2 list_handle.c -o listhandle
+ * Run:     ./listhandle [maxN]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BLOCK_MIN 16
+#define BLOCK_MAX 65536     // Largest block used for single appends
+
+// ====================== NODE BLOCKS ======================
+// One allocator for both node types: a chain of blocks of nodeSize-byte
+// slots. Only the newest block has free slots.
+struct NodeBlock {
+    struct NodeBlock* next;     // Older block
+    int used, capacity;
+    void* slots[];              // capacity * nodeSize bytes, pointer aligned
+};
+
+struct NodeBlocks {
+    size_t nodeSize;
+    struct NodeBlock* newest;
+};
+
+void blocksInit(struct NodeBlocks* blocks, size_t nodeSize) {
+    blocks->nodeSize = nodeSize;
+    blocks->newest = NULL;
+}
+
+// Returns count nodes next to each other in memory (a new block if the
+// current one has no room; its leftover slots are simply not used),
+// or NULL if out of memory
+void* blocksTake(struct NodeBlocks* blocks, int count) {
+    struct NodeBlock* b = blocks->newest;
+    if (b == NULL || b->capacity - b->used < count) {
+        int capacity = b == NULL ? BLOCK_MIN : b->capacity * 2;
+        if (capacity > BLOCK_MAX) capacity = BLOCK_MAX;
+        if (capacity < count) capacity = count;
+        struct NodeBlock* newBlock = malloc(sizeof(struct NodeBlock) + capacity * blocks->nodeSize);
+        if (newBlock == NULL) return NULL;
+        newBlock->used = 0;
+        newBlock->capacity = capacity;
+        newBlock->next = b;
+        blocks->newest = b = newBlock;
+    }
+    void* nodes = (char*)b->slots + b->used * blocks->nodeSize;
+    b->used += count;
+    return nodes;
+}
+
+void blocksFree(struct NodeBlocks* blocks) {
+    while (blocks->newest != NULL) {
+        struct NodeBlock* next = blocks->newest->next;
+        free(blocks->newest);
+        blocks->newest = next;
+    }
+}
+
+// ====================== SINGLY LINKED ======================
+struct Node {
+    int data;
+    struct Node* next;
+};
+
+struct ListHandle {
+    struct Node* head;
+    struct Node* tail;
+    int size;
+    struct NodeBlocks blocks;
+};
+
+void listHandleInit(struct ListHandle* list) {
+    list->head = list->tail = NULL;
+    list->size = 0;
+    blocksInit(&list->blocks, sizeof(struct Node));
+}
+
+// Returns 0 (list unchanged) if out of memory
+int listHandleAppend(struct ListHandle* list, int data) {
+    struct Node* newNode = blocksTake(&list->blocks, 1);
+    if (newNode == NULL) return 0;
+    newNode->data = data;
+    newNode->next = NULL;
+    if (list->tail == NULL) list->head = newNode;
+    else list->tail->next = newNode;
+    list->tail = newNode;
+    list->size++;
+    return 1;
+}
+
+int listHandleAppendArray(struct ListHandle* list, const int a[], int n) {
+    if (n <= 0) return 1;
+    struct Node* nodes = blocksTake(&list->blocks, n);
+    if (nodes == NULL) return 0;
+    for (int i = 0; i < n; i++) {
+        nodes[i].data = a[i];
+        nodes[i].next = &nodes[i + 1];
+    }
+    nodes[n - 1].next = NULL;
+
+    if (list->tail == NULL) list->head = nodes;
+    else list->tail->next = nodes;
+    list->tail = &nodes[n - 1];
+    list->size += n;
+    return 1;
+}
+
+void listHandleFree(struct ListHandle* list) {
+    blocksFree(&list->blocks);
+    listHandleInit(list);
+}
+
+// ====================== DOUBLY LINKED ======================
+struct DNode {
+    int data;
+    struct DNode* prev;
+    struct DNode* next;
+};
+
+struct DListHandle {
+    struct DNode* head;
+    struct DNode* tail;
+    int size;
+    struct NodeBlocks blocks;
+};
+
+void dlistHandleInit(struct DListHandle* list) {
+    list->head = list->tail = NULL;
+    list->size = 0;
+    blocksInit(&list->blocks, sizeof(struct DNode));
+}
+
+int dlistHandleAppend(struct DListHandle* list, int data) {
+    struct DNode* newNode = blocksTake(&list->blocks, 1);
+    if (newNode == NULL) return 0;
+    newNode->data = data;
+    newNode->next = NULL;
+    newNode->prev = list->tail;
+    if (list->tail == NULL) list->head = newNode;
+    else list->tail->next = newNode;
+    list->tail = newNode;
+    list->size++;
+    return 1;
+}
+
+int dlistHandleAppendArray(struct DListHandle* list, const int a[], int n) {
+    if (n <= 0) return 1;
+    struct DNode* nodes = blocksTake(&list->blocks, n);
+    if (nodes == NULL) return 0;
+    for (int i = 0; i < n; i++) {
+        nodes[i].data = a[i];
+        nodes[i].prev = i == 0 ? list->tail : &nodes[i - 1];
+        nodes[i].next = i == n - 1 ? NULL : &nodes[i + 1];
+    }
+
+    if (list->tail == NULL) list->head = nodes;
+    else list->tail->next = nodes;
+    list->tail = &nodes[n - 1];
+    list->size += n;
+    return 1;
+}
+
+void dlistHandleFree(struct DListHandle* list) {
+    blocksFree(&list->blocks);
+    dlistHandleInit(list);
+}
+
+// ====================== BENCHMARK ======================
+// singly.c's insertEnd: walks to the end every time
+void insertEnd(struct Node** head, int data) {
+    struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    newNode->data = data;
+    newNode->next = NULL;
+
+    if (*head == NULL) {
+        *head = newNode;
+        return;
+    }
+
+    struct Node* temp = *head;
+    while (temp->next != NULL) {
+        temp = temp->next;
+    }
+    temp->next = newNode;
+}
+
+void freeNodes(struct Node* head) {
+    while (head != NULL) {
+        struct Node* next = head->next;
+        free(head);
+        head = next;
+    }
+}
+
+// Values 0..n-1 in order, tail really the last node, and (doubly) prev links right?
+int checkList(struct Node* head, struct Node* tail, int n) {
+    int i = 0;
+    struct Node* last = NULL;
+    for (struct Node* p = head; p != NULL; p = p->next, i++) {
+        if (p->data != i) return 0;
+        last = p;
+    }
+    return i == n && last == tail;
+}
+
+int checkDList(struct DListHandle* list, int n) {
+    int i = n - 1;
+    struct DNode* first = NULL;
+    for (struct DNode* p = list->tail; p != NULL; p = p->prev, i--) {
+        if (p->data != i) return 0;
+        first = p;
+    }
+    return i == -1 && first == list->head && list->size == n;
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[]) {
+    int maxN = argc > 1 ? atoi(argv[1]) : 1000000;
+    int walkLimit = 50000;      // insertEnd beyond this is estimated from n^2
+
+    int* values = malloc(maxN * sizeof(int));
+    for (int i = 0; i < maxN; i++) values[i] = i;
+
+    printf("Building a list of 0..n-1 (ms)\n");
+    printf("        n | insertEnd walk | append (singly) | array (singly) | append (doubly) | array (doubly) | Correct\n");
+    printf("----------+----------------+-----------------+----------------+-----------------+----------------+--------\n");
+
+    double walkTime = 0;
+    int walkN = 0;
+    for (int n = 1000; n <= maxN; n *= 10) {
+        char walkText[32];
+        double t;
+        if (n <= walkLimit) {
+            struct Node* head = NULL;
+            t = nowSeconds();
+            for (int i = 0; i < n; i++) insertEnd(&head, i);
+            walkTime = nowSeconds() - t;
+            walkN = n;
+            freeNodes(head);
+            snprintf(walkText, sizeof(walkText), "%.1f", walkTime * 1e3);
+        } else {
+            double ratio = (double)n / walkN;
+            snprintf(walkText, sizeof(walkText), "~%.0f (est.)", walkTime * ratio * ratio * 1e3);
+        }
+
+        struct ListHandle list;
+        listHandleInit(&list);
+        t = nowSeconds();
+        for (int i = 0; i < n; i++) listHandleAppend(&list, i);
+        double appendTime = nowSeconds() - t;
+        int correct = checkList(list.head, list.tail, n) && list.size == n;
+        listHandleFree(&list);
+
+        t = nowSeconds();
+        listHandleAppendArray(&list, values, n / 2);
+        listHandleAppendArray(&list, values + n / 2, n - n / 2);   // Second call joins onto the tail
+        double arrayTime = nowSeconds() - t;
+        correct = correct && checkList(list.head, list.tail, n) && list.size == n;
+        listHandleFree(&list);
+
+        struct DListHandle dlist;
+        dlistHandleInit(&dlist);
+        t = nowSeconds();
+        for (int i = 0; i < n; i++) dlistHandleAppend(&dlist, i);
+        double dAppendTime = nowSeconds() - t;
+        correct = correct && checkDList(&dlist, n);
+        dlistHandleFree(&dlist);
+
+        t = nowSeconds();
+        dlistHandleAppendArray(&dlist, values, n / 2);
+        dlistHandleAppendArray(&dlist, values + n / 2, n - n / 2);
+        double dArrayTime = nowSeconds() - t;
+        correct = correct && checkDList(&dlist, n);
+        dlistHandleFree(&dlist);
+
+        printf("%9d | %14s | %15.2f | %14.2f | %15.2f | %14.2f | %s\n", n, walkText,
+               appendTime * 1e3, arrayTime * 1e3, dAppendTime * 1e3, dArrayTime * 1e3, correct ? "yes" : "NO");
+        if (n < maxN && n * 10LL > maxN) n = maxN / 10;   // end exactly at maxN
+    }
+
+    free(values);
+    return 0;
+}
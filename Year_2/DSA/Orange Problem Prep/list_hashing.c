@@ -0,0 +1,514 @@
+/*
+ * HASHING ON LINKED LISTS: DEDUPE, PAIR/TRIPLE SUMS, DISTINCT COUNT
+ * =================================================================
+ *
+ * singly.c's removeDuplicates only removes ADJACENT duplicates (the
+ * list must be sorted) and doubly.c's findPairs needs a sorted list for
+ * its two pointers. Sorting a linked list first costs O(n log n), and
+ * the nested-loop versions for unsorted data cost O(n^2).
+ *
+ * A hash table of value -> count answers "seen before?" in O(1)
+ * on average, which gives:
+ *
+ * 1. removeDuplicatesUnsorted: keep the first copy of every value. O(n)
+ * 2. findPairsUnsorted:  count[a] for every value, then for each
+ *    distinct a look up target - a. O(n)
+ * 3. findTriplesUnsorted: for each pair of distinct values a <= b look
+ *    up target - a - b. O(n + d^2) for d distinct values; 3-sum has no
+ *    known much-better algorithm, so this is for d in the thousands.
+ * 4. Distinct count: exact = number of keys in the table (memory grows
+ *    with d). HYPERLOGLOG estimates it in a fixed 16 KB: hash every
+ *    value, use the first 14 bits to pick one of 16384 registers and
+ *    keep the longest run of leading zeros seen in the rest. Seeing k
+ *    leading zeros takes about 2^k different values, so the registers'
+ *    harmonic mean gives the count to about 1.04 / sqrt(16384) = 0.8%.
+ *
+ * Pair and triple counts are over NODES (two equal values in different
+ * nodes count separately), so they can be checked against nested loops;
+ * the distinct value combinations are printed. With up to INT_MAX nodes
+ * a pair count always fits in a long long, a triple count does not:
+ * c*(c-1)*(c-2) overflows at about 2.1 million equal values. Triples are
+ * counted in 128 bits and the result saturates at LLONG_MAX.
+ *
+ * The table: open addressing with linear probing, capacity a power of
+ * two, Fibonacci hashing (multiply by 2^32 / golden ratio, keep the top
+ * bits). INT_MIN marks an empty slot; the value INT_MIN itself is
+ * counted on the side.
+ *
+ * Compile: gcc -O2 list_hashing.c -o listhash -lm
+ * Run:     ./listhash [maxN]
+ */
+
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+struct Node {
+    int data;
+    struct Node* next;
+};
+
+// ====================== HASH TABLE: value -> count ======================
+#define EMPTY INT_MIN
+
+struct CountMap {
+    int* keys;
+    int* counts;
+    unsigned int capacity;      // Power of two
+    unsigned int shift;         // 32 - log2(capacity)
+    int size;                   // Distinct keys, including EMPTY if seen
+    int emptyKeyCount;          // How many times INT_MIN itself was added
+};
+
+void mapInit(struct CountMap* map, int expected) {
+    map->capacity = 16;
+    map->shift = 28;
+    while (map->capacity < (unsigned int)expected + expected / 3) {
+        map->capacity *= 2;
+        map->shift--;
+    }
+    map->keys = malloc(map->capacity * sizeof(int));
+    map->counts = malloc(map->capacity * sizeof(int));
+    for (unsigned int i = 0; i < map->capacity; i++) map->keys[i] = EMPTY;
+    map->size = 0;
+    map->emptyKeyCount = 0;
+}
+
+void mapFree(struct CountMap* map) {
+    free(map->keys);
+    free(map->counts);
+}
+
+unsigned int slotOf(const struct CountMap* map, int key) {
+    return ((unsigned int)key * 2654435769u) >> map->shift;
+}
+
+// Slot holding key, or the empty slot where it would go
+unsigned int findSlot(const struct CountMap* map, int key) {
+    unsigned int mask = map->capacity - 1;
+    unsigned int i = slotOf(map, key);
+    while (map->keys[i] != EMPTY && map->keys[i] != key) i = (i + 1) & mask;
+    return i;
+}
+
+void mapGrow(struct CountMap* map) {
+    int* oldKeys = map->keys;
+    int* oldCounts = map->counts;
+    unsigned int oldCapacity = map->capacity;
+
+    map->capacity *= 2;
+    map->shift--;
+    map->keys = malloc(map->capacity * sizeof(int));
+    map->counts = malloc(map->capacity * sizeof(int));
+    for (unsigned int i = 0; i < map->capacity; i++) map->keys[i] = EMPTY;
+    for (unsigned int i = 0; i < oldCapacity; i++) {
+        if (oldKeys[i] == EMPTY) continue;
+        unsigned int j = findSlot(map, oldKeys[i]);
+        map->keys[j] = oldKeys[i];
+        map->counts[j] = oldCounts[i];
+    }
+    free(oldKeys);
+    free(oldCounts);
+}
+
+// Add one copy of key, returns its count so far
+int mapAdd(struct CountMap* map, int key) {
+    if (key == EMPTY) {
+        if (map->emptyKeyCount == 0) map->size++;
+        return ++map->emptyKeyCount;
+    }
+    unsigned int i = findSlot(map, key);
+    if (map->keys[i] == EMPTY) {
+        // Keep the table at most 3/4 full so probe runs stay short
+        if ((map->size + 1) * 4LL > map->capacity * 3LL) {
+            mapGrow(map);
+            i = findSlot(map, key);
+        }
+        map->keys[i] = key;
+        map->counts[i] = 0;
+        map->size++;
+    }
+    return ++map->counts[i];
+}
+
+int mapGet(const struct CountMap* map, long long key) {
+    if (key < INT_MIN || key > INT_MAX) return 0;
+    if (key == EMPTY) return map->emptyKeyCount;
+    unsigned int i = findSlot(map, (int)key);
+    return map->keys[i] == EMPTY ? 0 : map->counts[i];
+}
+
+int compareInts(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// All distinct keys into a new array (table order), *count receives how many
+int* mapKeys(const struct CountMap* map, int* count) {
+    int* keys = malloc((map->size + 1) * sizeof(int));
+    int k = 0;
+    if (map->emptyKeyCount > 0) keys[k++] = EMPTY;
+    for (unsigned int i = 0; i < map->capacity; i++)
+        if (map->keys[i] != EMPTY) keys[k++] = map->keys[i];
+    *count = k;
+    return keys;
+}
+
+void countValues(struct Node* head, struct CountMap* map) {
+    mapInit(map, 1024);
+    for (struct Node* p = head; p != NULL; p = p->next) mapAdd(map, p->data);
+}
+
+// ====================== 1. DEDUPE AN UNSORTED LIST ======================
+// Keeps the first copy of every value, in the original order
+void removeDuplicatesUnsorted(struct Node* head) {
+    struct CountMap seen;
+    mapInit(&seen, 1024);
+    struct Node* prev = NULL;
+    struct Node* current = head;
+    while (current != NULL) {
+        if (mapAdd(&seen, current->data) > 1) {
+            prev->next = current->next;     // Never the head: its value is new
+            free(current);
+            current = prev->next;
+        } else {
+            prev = current;
+            current = current->next;
+        }
+    }
+    mapFree(&seen);
+}
+
+// ====================== 2. PAIRS WITH A GIVEN SUM ======================
+long long choose2(long long c) { return c * (c - 1) / 2; }
+unsigned __int128 choose3(unsigned __int128 c) { return c < 3 ? 0 : c * (c - 1) * (c - 2) / 6; }
+
+// Returns the number of node pairs with data sum == target and prints
+// the first printLimit distinct value pairs (a, b), a <= b.
+// The keys are not sorted: each pair is counted from its smaller value.
+long long findPairsUnsorted(struct Node* head, int target, int printLimit) {
+    struct CountMap counts;
+    countValues(head, &counts);
+    int d;
+    int* values = mapKeys(&counts, &d);
+
+    long long pairs = 0;
+    int printed = 0;
+    for (int i = 0; i < d; i++) {
+        long long a = values[i], b = (long long)target - a;
+        if (b < a) continue;        // Counted when the loop reaches b
+        long long ways = a == b ? choose2(mapGet(&counts, a)) : (long long)mapGet(&counts, a) * mapGet(&counts, b);
+        if (ways == 0) continue;
+        pairs += ways;
+        if (printed++ < printLimit) printf("Pair: (%lld, %lld)\n", a, b);
+    }
+    free(values);
+    mapFree(&counts);
+    return pairs;
+}
+
+// ====================== 3. TRIPLES WITH A GIVEN SUM ======================
+// Same for a + b + c == target, a <= b <= c. Returns LLONG_MAX if the
+// count does not fit in a long long
+long long findTriplesUnsorted(struct Node* head, int target, int printLimit) {
+    struct CountMap counts;
+    countValues(head, &counts);
+    int d;
+    int* values = mapKeys(&counts, &d);
+    // Sorted so the inner loop can stop once c < b; O(d log d) is well
+    // inside the O(d^2) of the loops
+    qsort(values, d, sizeof(int), compareInts);
+
+    unsigned __int128 triples = 0;      // At most C(INT_MAX, 3) < 2^92
+    int printed = 0;
+    for (int i = 0; i < d; i++) {
+        long long a = values[i];
+        unsigned __int128 ca = mapGet(&counts, a);
+        for (int j = i; j < d; j++) {
+            long long b = values[j], c = (long long)target - a - b;
+            if (c < b) break;
+            unsigned __int128 cb = mapGet(&counts, b), cc = mapGet(&counts, c);
+            unsigned __int128 ways;
+            if (a == b && b == c) ways = choose3(ca);
+            else if (a == b) ways = choose2(ca) * cc;
+            else if (b == c) ways = ca * choose2(cb);
+            else ways = ca * cb * cc;
+            if (ways == 0) continue;
+            triples += ways;
+            if (printed++ < printLimit) printf("Triple: (%lld, %lld, %lld)\n", a, b, c);
+        }
+    }
+    free(values);
+    mapFree(&counts);
+    return triples > LLONG_MAX ? LLONG_MAX : (long long)triples;
+}
+
+// ====================== 4. HYPERLOGLOG ======================
+#define HLL_BITS 14
+#define HLL_REGISTERS (1 << HLL_BITS)
+
+struct HyperLogLog {
+    unsigned char registers[HLL_REGISTERS];
+};
+
+// splitmix64 finalizer: every input bit affects every output bit
+unsigned long long mix64(unsigned long long x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+void hllInit(struct HyperLogLog* hll) {
+    for (int i = 0; i < HLL_REGISTERS; i++) hll->registers[i] = 0;
+}
+
+void hllAdd(struct HyperLogLog* hll, int value) {
+    unsigned long long h = mix64((unsigned int)value);
+    int index = (int)(h >> (64 - HLL_BITS));
+    // The set bit caps the count if the remaining bits are all zero
+    unsigned long long rest = (h << HLL_BITS) | (1ULL << (HLL_BITS - 1));
+    unsigned char rank = (unsigned char)(__builtin_clzll(rest) + 1);
+    if (rank > hll->registers[index]) hll->registers[index] = rank;
+}
+
+double hllEstimate(const struct HyperLogLog* hll) {
+    double m = HLL_REGISTERS;
+    double sum = 0;
+    int zeros = 0;
+    for (int i = 0; i < HLL_REGISTERS; i++) {
+        sum += ldexp(1.0, -hll->registers[i]);
+        if (hll->registers[i] == 0) zeros++;
+    }
+    double alpha = 0.7213 / (1 + 1.079 / m);
+    double estimate = alpha * m * m / sum;
+    // Few values: many registers still empty, linear counting is better
+    if (estimate <= 2.5 * m && zeros > 0) estimate = m * log(m / zeros);
+    return estimate;
+}
+
+// ====================== BASELINES: NESTED LOOPS ======================
+void removeDuplicatesNaive(struct Node* head) {
+    for (struct Node* p = head; p != NULL; p = p->next) {
+        struct Node* prev = p;
+        while (prev->next != NULL) {
+            if (prev->next->data == p->data) {
+                struct Node* temp = prev->next;
+                prev->next = temp->next;
+                free(temp);
+            } else {
+                prev = prev->next;
+            }
+        }
+    }
+}
+
+long long findPairsNaive(struct Node* head, int target) {
+    long long pairs = 0;
+    for (struct Node* p = head; p != NULL; p = p->next)
+        for (struct Node* q = p->next; q != NULL; q = q->next)
+            if ((long long)p->data + q->data == target) pairs++;
+    return pairs;
+}
+
+long long findTriplesNaive(struct Node* head, int target) {
+    long long triples = 0;
+    for (struct Node* p = head; p != NULL; p = p->next)
+        for (struct Node* q = p->next; q != NULL; q = q->next)
+            for (struct Node* r = q->next; r != NULL; r = r->next)
+                if ((long long)p->data + q->data + r->data == target) triples++;
+    return triples;
+}
+
+// ====================== BENCHMARK ======================
+unsigned int nextRandom(unsigned int* state) {
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+// n nodes with values in [0, range), built with a tail pointer
+struct Node* randomList(int n, int range, unsigned int seed) {
+    struct Node* head = NULL;
+    struct Node* tail = NULL;
+    for (int i = 0; i < n; i++) {
+        struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+        newNode->data = (int)(nextRandom(&seed) % range);
+        newNode->next = NULL;
+        if (head == NULL) head = newNode;
+        else tail->next = newNode;
+        tail = newNode;
+    }
+    return head;
+}
+
+struct Node* listFromArray(const int a[], int n) {
+    struct Node* head = NULL;
+    for (int i = n - 1; i >= 0; i--) {
+        struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+        newNode->data = a[i];
+        newNode->next = head;
+        head = newNode;
+    }
+    return head;
+}
+
+void freeList(struct Node* head) {
+    while (head != NULL) {
+        struct Node* next = head->next;
+        free(head);
+        head = next;
+    }
+}
+
+int sameList(struct Node* a, struct Node* b) {
+    while (a != NULL && b != NULL && a->data == b->data) {
+        a = a->next;
+        b = b->next;
+    }
+    return a == NULL && b == NULL;
+}
+
+// INT_MIN is the table's empty marker and INT_MIN/INT_MAX sums leave
+// the int range: hash versions must still agree with the nested loops
+int checkEdgeValues() {
+    int values[] = { INT_MAX, INT_MIN, 0, INT_MIN, -1, INT_MAX, 1, INT_MIN, INT_MAX - 1, INT_MIN + 1, 0 };
+    int n = sizeof(values) / sizeof(values[0]);
+    int targets[] = { -1, 0, -2, INT_MIN, INT_MAX, INT_MAX - 1, INT_MIN + 1 };
+    int ok = 1;
+    for (int t = 0; t < (int)(sizeof(targets) / sizeof(targets[0])); t++) {
+        struct Node* list = listFromArray(values, n);
+        ok &= findPairsUnsorted(list, targets[t], 0) == findPairsNaive(list, targets[t]);
+        ok &= findTriplesUnsorted(list, targets[t], 0) == findTriplesNaive(list, targets[t]);
+        freeList(list);
+    }
+    struct Node* a = listFromArray(values, n);
+    struct Node* b = listFromArray(values, n);
+    removeDuplicatesUnsorted(a);
+    removeDuplicatesNaive(b);
+    ok &= sameList(a, b);
+    freeList(a);
+    freeList(b);
+    return ok;
+}
+
+// n equal values: every triple of nodes sums to 0
+int checkLargeCounts() {
+    struct Node* list = randomList(3000000, 1, 1);      // All 0
+    int ok = findTriplesUnsorted(list, 0, 0) == 4499995500001000000LL;   // C(3000000, 3)
+    freeList(list);
+    list = randomList(4000000, 1, 1);                   // C(4000000, 3) > LLONG_MAX
+    ok &= findTriplesUnsorted(list, 0, 0) == LLONG_MAX;
+    ok &= findPairsUnsorted(list, 0, 0) == 7999998000000LL;
+    freeList(list);
+    return ok;
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[]) {
+    int maxN = argc > 1 ? atoi(argv[1]) : 10000000;
+    int naiveLimit = 100000;        // Nested loops beyond this would take minutes
+    int tripleLimit = 1000;         // O(n^3) nested loops for triples
+
+    // Small demo
+    struct Node* demo = randomList(12, 10, 7);
+    printf("List:  ");
+    for (struct Node* p = demo; p != NULL; p = p->next) printf("%d ", p->data);
+    removeDuplicatesUnsorted(demo);
+    printf("\nDedup: ");
+    for (struct Node* p = demo; p != NULL; p = p->next) printf("%d ", p->data);
+    printf("\nPairs with sum 10:\n");
+    findPairsUnsorted(demo, 10, 10);
+    printf("Triples with sum 10:\n");
+    findTriplesUnsorted(demo, 10, 10);
+    freeList(demo);
+    printf("INT_MIN/INT_MAX values match nested loops: %s\n", checkEdgeValues() ? "yes" : "NO");
+    printf("Triple count of 3M equal values exact, of 4M saturated: %s\n", checkLargeCounts() ? "yes" : "NO");
+
+    printf("\nValues are random in [0, n/2); pair target n/2, triple target 3n/4\n\n");
+    printf("        n | dedupe hash ms | dedupe loops ms | pairs hash ms | pairs loops ms | Same\n");
+    printf("----------+----------------+-----------------+---------------+----------------+-----\n");
+    for (int n = 1000; n <= maxN; n *= 10) {
+        int range = n / 2 > 0 ? n / 2 : 1;
+        struct Node* a = randomList(n, range, 2463534242u);
+        struct Node* b = randomList(n, range, 2463534242u);
+
+        double t = nowSeconds();
+        long long pairs = findPairsUnsorted(a, range, 0);
+        double pairHash = nowSeconds() - t;
+        t = nowSeconds();
+        removeDuplicatesUnsorted(a);
+        double dedupeHash = nowSeconds() - t;
+
+        if (n <= naiveLimit) {
+            t = nowSeconds();
+            long long naivePairs = findPairsNaive(b, range);
+            double pairNaive = nowSeconds() - t;
+            t = nowSeconds();
+            removeDuplicatesNaive(b);
+            double dedupeNaive = nowSeconds() - t;
+            printf("%9d | %14.1f | %15.1f | %13.1f | %14.1f | %s\n", n, dedupeHash * 1e3, dedupeNaive * 1e3,
+                   pairHash * 1e3, pairNaive * 1e3, sameList(a, b) && pairs == naivePairs ? "yes" : "NO");
+        } else {
+            printf("%9d | %14.1f | %15s | %13.1f | %14s |\n", n, dedupeHash * 1e3, "skipped", pairHash * 1e3, "skipped");
+        }
+        freeList(a);
+        freeList(b);
+        if (n < maxN && n * 10LL > maxN) n = maxN / 10;   // end exactly at maxN
+    }
+
+    printf("\n        n | triples hash ms | triples loops ms | Same\n");
+    printf("----------+-----------------+------------------+-----\n");
+    for (int n = 250; n <= 16000; n *= 2) {
+        struct Node* list = randomList(n, n / 2, 2463534242u);
+        double t = nowSeconds();
+        long long triples = findTriplesUnsorted(list, 3 * (n / 2) / 2, 0);
+        double hashTime = nowSeconds() - t;
+        if (n <= tripleLimit) {
+            t = nowSeconds();
+            long long naive = findTriplesNaive(list, 3 * (n / 2) / 2);
+            double naiveTime = nowSeconds() - t;
+            printf("%9d | %15.1f | %16.1f | %s\n", n, hashTime * 1e3, naiveTime * 1e3, triples == naive ? "yes" : "NO");
+        } else {
+            printf("%9d | %15.1f | %16s |\n", n, hashTime * 1e3, "skipped");
+        }
+        freeList(list);
+    }
+
+    printf("\nDistinct values: exact hash table vs HyperLogLog (%d KB)\n", HLL_REGISTERS / 1024);
+    printf("        n |    distinct | exact ms | table MB |    estimate |  error | HLL ms\n");
+    printf("----------+-------------+----------+----------+-------------+--------+-------\n");
+    for (int n = 1000; n <= maxN; n *= 10) {
+        struct Node* list = randomList(n, n / 2 > 0 ? n / 2 : 1, 2463534242u);
+        double t = nowSeconds();
+        struct CountMap counts;
+        countValues(list, &counts);
+        double exactTime = nowSeconds() - t;
+
+        struct HyperLogLog hll;
+        t = nowSeconds();
+        hllInit(&hll);
+        for (struct Node* p = list; p != NULL; p = p->next) hllAdd(&hll, p->data);
+        double estimate = hllEstimate(&hll);
+        double hllTime = nowSeconds() - t;
+
+        printf("%9d | %11d | %8.1f | %8.1f | %11.0f | %5.2f%% | %6.1f\n", n, counts.size, exactTime * 1e3,
+               counts.capacity * 2.0 * sizeof(int) / (1 << 20), estimate,
+               100 * fabs(estimate - counts.size) / counts.size, hllTime * 1e3);
+        mapFree(&counts);
+        freeList(list);
+        if (n < maxN && n * 10LL > maxN) n = maxN / 10;
+    }
+    return 0;
+}
@@ -82,32 +82,45 @@ int circularDequeue(struct CircularQueue* q) {
     return item;
 }
 
-// Priority Queue
+// Priority Queue (binary max-heap, grows when full)
+// Push and pop are O(log n) instead of shifting items like insertion sort
 struct PriorityQueue {
-    int items[SIZE];
+    int* items;
     int size;
+    int capacity;
 };
 
 void initPriorityQueue(struct PriorityQueue* pq) {
+    pq->items = (int*)malloc(SIZE * sizeof(int));
+    pq->capacity = pq->items != NULL ? SIZE : 0;
     pq->size = 0;
 }
 
+void freePriorityQueue(struct PriorityQueue* pq) {
+    free(pq->items);
+    pq->items = NULL;
+    pq->size = pq->capacity = 0;
+}
+
 void priorityEnqueue(struct PriorityQueue* pq, int value) {
-    if (pq->size == SIZE) {
-        printf("Priority queue is full\n");
-        return;
+    if (pq->size == pq->capacity) {
+        int capacity = pq->capacity > 0 ? pq->capacity * 2 : SIZE;
+        int* items = (int*)realloc(pq->items, capacity * sizeof(int));
+        if (items == NULL) {
+            printf("Priority queue is full (out of memory)\n");
+            return;     // Old items are still there
+        }
+        pq->items = items;
+        pq->capacity = capacity;
     }
     
-    int i;
-    for (i = pq->size - 1; i >= 0; i--) {
-        if (pq->items[i] > value) {
-            pq->items[i + 1] = pq->items[i];
-        } else {
-            break;
-        }
+    // Move smaller parents down until value fits
+    int i = pq->size++;
+    while (i > 0 && pq->items[(i - 1) / 2] < value) {
+        pq->items[i] = pq->items[(i - 1) / 2];
+        i = (i - 1) / 2;
     }
-    pq->items[i + 1] = value;
-    pq->size++;
+    pq->items[i] = value;
 }
 
 int priorityDequeue(struct PriorityQueue* pq) {
@@ -115,7 +128,24 @@ int priorityDequeue(struct PriorityQueue* pq) {
         printf("Priority queue is empty\n");
         return -1;
     }
-    return pq->items[--pq->size];
+    int max = pq->items[0];
+    int last = pq->items[--pq->size];
+    
+    // Move bigger children up until last fits
+    int i = 0;
+    while (2 * i + 1 < pq->size) {
+        int child = 2 * i + 1;
+        if (child + 1 < pq->size && pq->items[child + 1] > pq->items[child]) {
+            child++;
+        }
+        if (pq->items[child] <= last) {
+            break;
+        }
+        pq->items[i] = pq->items[child];
+        i = child;
+    }
+    pq->items[i] = last;
+    return max;
 }
 
 // Double Ended Queue (Deque)
@@ -14,7 +14,7 @@ void insertBeginning(struct Node** head, int data) {
     *head = newNode;
 }
 
-// Insert at end
+// Insert at end (walks the whole list: O(n); list_handle.c keeps a tail for O(1))
 void insertEnd(struct Node** head, int data) {
     struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
     newNode->data = data;
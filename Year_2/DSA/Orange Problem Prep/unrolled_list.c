@@ -0,0 +1,400 @@
+/*
+ * UNROLLED LINKED LIST
+ * ====================
+ *
+ * singly.c's struct Node holds one 4-byte int and an 8-byte pointer,
+ * and malloc adds its own 8-16 bytes on top: about 32 bytes of memory
+ * per value, and every step of a walk can be a cache miss.
+ *
+ * An unrolled list stores SEVERAL values per node. Here a node is 64
+ * bytes, a cache line's worth: next pointer + count + 13 ints, so a
+ * walk makes one pointer hop per 13 values (at least 6 when half full).
+ *
+ * Rules that keep it dense:
+ *   - Insert into a full block: split it, half the values move to a new
+ *     block right after it
+ *   - Delete leaving a block less than half full: take values from the
+ *     next block, or merge with it if both fit in one
+ * So every block except possibly the last is at least half full
+ * (reverseList refills the old last block when it becomes the first).
+ *
+ * Same operations as singly.c (insertBeginning, insertEnd, deleteNode,
+ * reverseList, removeDuplicates, findMiddle) plus insertAt and
+ * traverse, on a struct UnrolledList handle that also keeps the tail
+ * and size.
+ *
+ * Compile: gcc -O2 unrolled_list.c -o unrolled
+ * Run:     ./unrolled [n]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BLOCK_BYTES 64
+#define BLOCK_VALUES ((BLOCK_BYTES - sizeof(void*) - sizeof(int)) / sizeof(int))   // 13 on 64-bit
+#define HALF ((int)BLOCK_VALUES / 2)
+
+struct Block {
+    struct Block* next;
+    int count;
+    int values[BLOCK_VALUES];
+};
+
+struct UnrolledList {
+    struct Block* head;
+    struct Block* tail;
+    int size;
+};
+
+_Static_assert(sizeof(struct Block) == BLOCK_BYTES, "a block should be BLOCK_BYTES");
+
+struct Block* newBlock() {
+    // Plain malloc: glibc's aligned_alloc would line blocks up with cache
+    // lines but scatters them through the heap, which costs far more
+    struct Block* b = malloc(sizeof(struct Block));
+    b->next = NULL;
+    b->count = 0;
+    return b;
+}
+
+void initList(struct UnrolledList* list) {
+    list->head = list->tail = NULL;
+    list->size = 0;
+}
+
+void freeList(struct UnrolledList* list) {
+    struct Block* b = list->head;
+    while (b != NULL) {
+        struct Block* next = b->next;
+        free(b);
+        b = next;
+    }
+    initList(list);
+}
+
+// Move the top half of a full block into a new block right after it
+void splitBlock(struct UnrolledList* list, struct Block* b) {
+    struct Block* second = newBlock();
+    int keep = b->count / 2;
+    second->count = b->count - keep;
+    memcpy(second->values, b->values + keep, second->count * sizeof(int));
+    b->count = keep;
+    second->next = b->next;
+    b->next = second;
+    if (list->tail == b) list->tail = second;
+}
+
+// Insert data so it ends up at position pos (0 = front, size = end)
+void insertAt(struct UnrolledList* list, int pos, int data) {
+    if (pos < 0 || pos > list->size) return;
+    if (list->head == NULL) list->head = list->tail = newBlock();
+
+    // Find the block: pos == size lands at the end of the tail
+    struct Block* b;
+    if (pos == list->size) {
+        b = list->tail;
+        pos = b->count;
+    } else {
+        b = list->head;
+        while (pos > b->count || (pos == b->count && b->next != NULL)) {
+            pos -= b->count;
+            b = b->next;
+        }
+    }
+
+    if (b->count == (int)BLOCK_VALUES) {
+        splitBlock(list, b);
+        if (pos > b->count) {
+            pos -= b->count;
+            b = b->next;
+        }
+    }
+    memmove(b->values + pos + 1, b->values + pos, (b->count - pos) * sizeof(int));
+    b->values[pos] = data;
+    b->count++;
+    list->size++;
+}
+
+void insertBeginning(struct UnrolledList* list, int data) {
+    insertAt(list, 0, data);
+}
+
+// O(1): straight to the tail block
+void insertEnd(struct UnrolledList* list, int data) {
+    struct Block* b = list->tail;
+    if (b == NULL || b->count == (int)BLOCK_VALUES) {
+        // Full tail: start a fresh block rather than splitting, so a list
+        // built by appending ends up with every block full
+        struct Block* fresh = newBlock();
+        if (b == NULL) list->head = fresh;
+        else b->next = fresh;
+        list->tail = b = fresh;
+    }
+    b->values[b->count++] = data;
+    list->size++;
+}
+
+// A block under half full that is not the last one: take values from
+// the next block, or merge the two if they fit in one
+void refill(struct UnrolledList* list, struct Block* b) {
+    struct Block* next = b->next;
+    if (b->count >= HALF || next == NULL) return;
+
+    if (b->count + next->count <= (int)BLOCK_VALUES) {
+        memcpy(b->values + b->count, next->values, next->count * sizeof(int));
+        b->count += next->count;
+        b->next = next->next;
+        if (list->tail == next) list->tail = b;
+        free(next);
+    } else {
+        int take = HALF - b->count;
+        memcpy(b->values + b->count, next->values, take * sizeof(int));
+        memmove(next->values, next->values + take, (next->count - take) * sizeof(int));
+        b->count += take;
+        next->count -= take;
+    }
+}
+
+// Delete the first value equal to key
+void deleteNode(struct UnrolledList* list, int key) {
+    struct Block* prev = NULL;
+    struct Block* b = list->head;
+    int i = 0;
+    while (b != NULL) {
+        for (i = 0; i < b->count && b->values[i] != key; i++);
+        if (i < b->count) break;
+        prev = b;
+        b = b->next;
+    }
+    if (b == NULL) return;
+
+    memmove(b->values + i, b->values + i + 1, (b->count - i - 1) * sizeof(int));
+    b->count--;
+    list->size--;
+
+    if (b->count == 0) {
+        // Only possible for a block that was allowed to be small: unlink it
+        if (prev == NULL) list->head = b->next;
+        else prev->next = b->next;
+        if (list->tail == b) list->tail = prev;
+        free(b);
+        return;
+    }
+    refill(list, b);
+}
+
+// Reverse the order of the blocks, and the values inside each block
+void reverseList(struct UnrolledList* list) {
+    struct Block* prev = NULL;
+    struct Block* current = list->head;
+    list->tail = current;
+    while (current != NULL) {
+        for (int i = 0, j = current->count - 1; i < j; i++, j--) {
+            int temp = current->values[i];
+            current->values[i] = current->values[j];
+            current->values[j] = temp;
+        }
+        struct Block* next = current->next;
+        current->next = prev;
+        prev = current;
+        current = next;
+    }
+    list->head = prev;
+    if (prev != NULL) refill(list, prev);   // The old last block may be small
+}
+
+// Remove duplicates from a SORTED list. Kept values are packed into the
+// front blocks as we go, so afterwards every block but the last is full.
+void removeDuplicates(struct UnrolledList* list) {
+    if (list->head == NULL) return;
+    struct Block* out = list->head;
+    int outCount = 0, kept = 0;
+    int last = 0;
+
+    for (struct Block* b = list->head; b != NULL; b = b->next) {
+        for (int i = 0; i < b->count; i++) {
+            int value = b->values[i];
+            if (kept > 0 && value == last) continue;
+            if (outCount == (int)BLOCK_VALUES) {
+                out->count = outCount;
+                out = out->next;    // Never passes b: we write at most as many as we read
+                outCount = 0;
+            }
+            out->values[outCount++] = value;
+            last = value;
+            kept++;
+        }
+    }
+    out->count = outCount;
+
+    // Free the blocks left over after the last written one
+    struct Block* extra = out->next;
+    out->next = NULL;
+    list->tail = out;
+    list->size = kept;
+    while (extra != NULL) {
+        struct Block* next = extra->next;
+        free(extra);
+        extra = next;
+    }
+}
+
+// Middle value (the second middle for an even size, like singly.c's
+// findMiddle); size is known, so just skip whole blocks. NULL if empty
+int* findMiddle(struct UnrolledList* list) {
+    if (list->size == 0) return NULL;
+    int pos = list->size / 2;
+    struct Block* b = list->head;
+    while (pos >= b->count) {
+        pos -= b->count;
+        b = b->next;
+    }
+    return &b->values[pos];
+}
+
+void traverse(struct UnrolledList* list) {
+    for (struct Block* b = list->head; b != NULL; b = b->next) {
+        printf("[");
+        for (int i = 0; i < b->count; i++) printf(i ? " %d" : "%d", b->values[i]);
+        printf("] -> ");
+    }
+    printf("NULL\n");
+}
+
+// ====================== BENCHMARK ======================
+// singly.c's node per value, with a tail pointer so appends are fair
+struct Node {
+    int data;
+    struct Node* next;
+};
+
+void nodeInsertEnd(struct Node** head, struct Node** tail, int data) {
+    struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    newNode->data = data;
+    newNode->next = NULL;
+    if (*head == NULL) *head = newNode;
+    else (*tail)->next = newNode;
+    *tail = newNode;
+}
+
+void nodeInsertAt(struct Node** head, int pos, int data) {
+    struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    newNode->data = data;
+    if (pos == 0) {
+        newNode->next = *head;
+        *head = newNode;
+        return;
+    }
+    struct Node* temp = *head;
+    for (int i = 0; i < pos - 1; i++) temp = temp->next;
+    newNode->next = temp->next;
+    temp->next = newNode;
+}
+
+void nodeFree(struct Node* head) {
+    while (head != NULL) {
+        struct Node* next = head->next;
+        free(head);
+        head = next;
+    }
+}
+
+unsigned int nextRandom(unsigned int* state) {
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void printRow(const char* operation, double nodeTime, double unrolledTime) {
+    printf("%-28s | %12.1f | %12.1f | %6.1fx\n", operation, nodeTime * 1e3, unrolledTime * 1e3, nodeTime / unrolledTime);
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 10000000;
+    int inserts = 500;      // Random-position inserts, each a walk
+
+    // Small demo
+    struct UnrolledList demo;
+    initList(&demo);
+    for (int i = 1; i <= 30; i++) insertEnd(&demo, i / 2);
+    traverse(&demo);
+    removeDuplicates(&demo);
+    printf("removeDuplicates: ");
+    traverse(&demo);
+    deleteNode(&demo, 3);
+    deleteNode(&demo, 4);
+    insertBeginning(&demo, 100);
+    insertAt(&demo, 5, 200);
+    printf("delete 3, 4, insert 100 at front, 200 at 5: ");
+    traverse(&demo);
+    reverseList(&demo);
+    printf("reversed: ");
+    traverse(&demo);
+    printf("middle: %d\n\n", *findMiddle(&demo));
+    freeList(&demo);
+
+    printf("%d values: node-per-value list (singly.c) vs unrolled (%d per 64-byte block)\n\n", n, (int)BLOCK_VALUES);
+    printf("Operation                    | node list ms |  unrolled ms | Speedup\n");
+    printf("-----------------------------+--------------+--------------+--------\n");
+
+    struct Node *head = NULL, *tail = NULL;
+    struct UnrolledList list;
+    initList(&list);
+
+    double t = nowSeconds();
+    for (int i = 0; i < n; i++) nodeInsertEnd(&head, &tail, i);
+    double nodeTime = nowSeconds() - t;
+    t = nowSeconds();
+    for (int i = 0; i < n; i++) insertEnd(&list, i);
+    printRow("insertEnd x n", nodeTime, nowSeconds() - t);
+
+    // Random inserts: both walk to the position, the unrolled list a block at a time
+    unsigned int seed = 2463534242u;
+    int* positions = malloc(inserts * sizeof(int));
+    for (int i = 0; i < inserts; i++) positions[i] = nextRandom(&seed) % (n + i + 1);
+    t = nowSeconds();
+    for (int i = 0; i < inserts; i++) nodeInsertAt(&head, positions[i], -i);
+    nodeTime = nowSeconds() - t;
+    t = nowSeconds();
+    for (int i = 0; i < inserts; i++) insertAt(&list, positions[i], -i);
+    char label[64];
+    snprintf(label, sizeof(label), "insertAt random x %d", inserts);
+    printRow(label, nodeTime, nowSeconds() - t);
+
+    long long nodeSum = 0, unrolledSum = 0;
+    t = nowSeconds();
+    for (struct Node* p = head; p != NULL; p = p->next) nodeSum += p->data;
+    nodeTime = nowSeconds() - t;
+    t = nowSeconds();
+    for (struct Block* b = list.head; b != NULL; b = b->next)
+        for (int i = 0; i < b->count; i++) unrolledSum += b->values[i];
+    printRow("traverse (sum)", nodeTime, nowSeconds() - t);
+
+    // Same sequence of values?
+    int same = nodeSum == unrolledSum;
+    struct Node* p = head;
+    for (struct Block* b = list.head; b != NULL && same; b = b->next)
+        for (int i = 0; i < b->count && same; i++, p = p->next) same = p != NULL && p->data == b->values[i];
+    same = same && p == NULL;
+
+    int blocks = 0;
+    for (struct Block* b = list.head; b != NULL; b = b->next) blocks++;
+    printf("\nBlocks: %d, %.1f values per block, %.1f bytes per value (node list: %zu + malloc header)\n",
+           blocks, (double)list.size / blocks, (double)blocks * BLOCK_BYTES / list.size, sizeof(struct Node));
+    printf("Same contents: %s\n", same ? "yes" : "NO");
+
+    nodeFree(head);
+    freeList(&list);
+    free(positions);
+    return 0;
+}
@@ -0,0 +1,463 @@
+// Addressable priority queues: push returns a HANDLE (pointer to the
+// element's node), so its priority can be changed or it can be removed
+// later without searching for it.
+//
+// 1. Pairing heap (any int keys, min on top)
+//    A tree where every node keeps its children in a linked list.
+//      push / meld    O(1)      link two roots, smaller one on top
+//      pop            O(log n)  amortized: meld the children in pairs
+//      decreaseKey    o(log n)  amortized: cut the subtree, meld it with root
+//      deleteNode     O(log n)  amortized
+//
+// 2. Radix heap (unsigned keys, MONOTONE: never push a key smaller than
+//    the last popped one - true for Dijkstra)
+//    Bucket i holds keys whose highest bit that differs from "last"
+//    is bit i-1. A key only moves to LOWER buckets, at most 33 times.
+//      push / decreaseKey / deleteNode  O(1)
+//      pop                              O(log C) amortized (C = max key)
+//
+// Benchmark: Dijkstra on a random graph, against a 4-ary heap that has
+// no decrease-key (push duplicates, skip stale entries when popped).
+//
+// Compile: gcc -O2 addressable_heap.c dary_heap.c -o dijkstra
+// Run:     ./dijkstra [vertices] [edgesPerVertex]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <time.h>
+#include "dary_heap.h"
+
+// ---------------- Pairing heap ----------------
+typedef struct PairNode {
+    int key;
+    int value;
+    struct PairNode *child;     // Leftmost child
+    struct PairNode *sibling;   // Next sibling to the right
+    struct PairNode *prev;      // Left sibling, or parent for the leftmost child
+} PairNode;
+
+typedef struct {
+    PairNode* root;
+    int size;
+} PairingHeap;
+
+void pairingInit(PairingHeap* h) {
+    h->root = NULL;
+    h->size = 0;
+}
+
+// Link two roots: the bigger one becomes the leftmost child of the smaller
+PairNode* meld(PairNode* a, PairNode* b) {
+    if (!a) return b;
+    if (!b) return a;
+    if (b->key < a->key) { PairNode* t = a; a = b; b = t; }
+    b->prev = a;
+    b->sibling = a->child;
+    if (a->child) a->child->prev = b;
+    a->child = b;
+    a->sibling = a->prev = NULL;
+    return a;
+}
+
+// Two-pass merge of a sibling list: meld pairs left to right,
+// then meld the results right to left
+PairNode* mergePairs(PairNode* first) {
+    if (!first) return NULL;
+    PairNode* pairs = NULL;     // Results of pass 1, linked in reverse
+    while (first) {
+        PairNode* a = first;
+        PairNode* b = a->sibling;
+        first = b ? b->sibling : NULL;
+        a->sibling = a->prev = NULL;
+        if (b) b->sibling = b->prev = NULL;
+        PairNode* m = meld(a, b);
+        m->sibling = pairs;
+        pairs = m;
+    }
+    PairNode* result = NULL;
+    while (pairs) {
+        PairNode* next = pairs->sibling;
+        pairs->sibling = NULL;
+        result = meld(result, pairs);
+        pairs = next;
+    }
+    return result;
+}
+
+// Insert a node the caller owns (e.g. one node per graph vertex, no malloc)
+void pairingInsertNode(PairingHeap* h, PairNode* n, int key, int value) {
+    n->key = key;
+    n->value = value;
+    n->child = n->sibling = n->prev = NULL;
+    h->root = meld(h->root, n);
+    h->size++;
+}
+
+// Remove the minimum node and return it (NULL if empty); not freed
+PairNode* pairingPopNode(PairingHeap* h) {
+    PairNode* top = h->root;
+    if (!top) return NULL;
+    h->root = mergePairs(top->child);
+    h->size--;
+    return top;
+}
+
+PairNode* pairingPush(PairingHeap* h, int key, int value) {
+    PairNode* n = malloc(sizeof(PairNode));
+    pairingInsertNode(h, n, key, value);
+    return n;
+}
+
+PairNode* pairingPeek(PairingHeap* h) {
+    return h->root;
+}
+
+// Removes the minimum; returns 0 if empty
+int pairingPop(PairingHeap* h, int* key, int* value) {
+    PairNode* top = pairingPopNode(h);
+    if (!top) return 0;
+    if (key) *key = top->key;
+    if (value) *value = top->value;
+    free(top);
+    return 1;
+}
+
+// Unlink n (and its subtree) from its parent's child list
+void cut(PairNode* n) {
+    if (n->prev->child == n) n->prev->child = n->sibling;
+    else n->prev->sibling = n->sibling;
+    if (n->sibling) n->sibling->prev = n->prev;
+    n->sibling = n->prev = NULL;
+}
+
+void pairingDecreaseKey(PairingHeap* h, PairNode* n, int newKey) {
+    if (newKey > n->key) return;    // Only decreases are allowed
+    n->key = newKey;
+    if (n == h->root) return;
+    cut(n);
+    h->root = meld(h->root, n);
+}
+
+void pairingDelete(PairingHeap* h, PairNode* n) {
+    if (n == h->root) {
+        pairingPop(h, NULL, NULL);
+        return;
+    }
+    cut(n);
+    h->root = meld(h->root, mergePairs(n->child));
+    h->size--;
+    free(n);
+}
+
+void pairingFree(PairingHeap* h) {
+    while (pairingPop(h, NULL, NULL)) ;
+}
+
+// ---------------- Radix heap ----------------
+#define BUCKETS 33
+
+typedef struct RadixNode {
+    unsigned int key;
+    int value;
+    int bucket;
+    struct RadixNode *prev, *next;  // Doubly linked bucket list: O(1) removal
+} RadixNode;
+
+typedef struct {
+    RadixNode* buckets[BUCKETS];
+    unsigned int last;              // Last popped key
+    int size;
+} RadixHeap;
+
+void radixInit(RadixHeap* h) {
+    for (int i = 0; i < BUCKETS; i++) h->buckets[i] = NULL;
+    h->last = 0;
+    h->size = 0;
+}
+
+// 0 if key == last, else 1 + position of the highest differing bit
+int bucketOf(RadixHeap* h, unsigned int key) {
+    unsigned int diff = key ^ h->last;
+    return diff ? 32 - __builtin_clz(diff) : 0;
+}
+
+void bucketAdd(RadixHeap* h, RadixNode* n) {
+    int b = bucketOf(h, n->key);
+    n->bucket = b;
+    n->prev = NULL;
+    n->next = h->buckets[b];
+    if (n->next) n->next->prev = n;
+    h->buckets[b] = n;
+}
+
+void bucketRemove(RadixHeap* h, RadixNode* n) {
+    if (n->prev) n->prev->next = n->next;
+    else h->buckets[n->bucket] = n->next;
+    if (n->next) n->next->prev = n->prev;
+}
+
+// key must be >= the last popped key. Node is owned by the caller.
+void radixInsertNode(RadixHeap* h, RadixNode* n, unsigned int key, int value) {
+    n->key = key;
+    n->value = value;
+    bucketAdd(h, n);
+    h->size++;
+}
+
+RadixNode* radixPush(RadixHeap* h, unsigned int key, int value) {
+    RadixNode* n = malloc(sizeof(RadixNode));
+    radixInsertNode(h, n, key, value);
+    return n;
+}
+
+// Remove the minimum node and return it (NULL if empty); not freed
+RadixNode* radixPopNode(RadixHeap* h) {
+    if (h->size == 0) return NULL;
+    if (!h->buckets[0]) {
+        // Smallest key is in the first non-empty bucket: make it "last"
+        // and spread that bucket into lower buckets
+        int b = 1;
+        while (!h->buckets[b]) b++;
+        RadixNode* n = h->buckets[b];
+        unsigned int min = n->key;
+        for (RadixNode* x = n->next; x; x = x->next)
+            if (x->key < min) min = x->key;
+        h->last = min;
+        h->buckets[b] = NULL;
+        while (n) {
+            RadixNode* next = n->next;
+            bucketAdd(h, n);
+            n = next;
+        }
+    }
+    RadixNode* top = h->buckets[0];
+    bucketRemove(h, top);
+    h->size--;
+    return top;
+}
+
+int radixPop(RadixHeap* h, unsigned int* key, int* value) {
+    RadixNode* top = radixPopNode(h);
+    if (!top) return 0;
+    if (key) *key = top->key;
+    if (value) *value = top->value;
+    free(top);
+    return 1;
+}
+
+void radixDecreaseKey(RadixHeap* h, RadixNode* n, unsigned int newKey) {
+    if (newKey > n->key || newKey < h->last) return;
+    bucketRemove(h, n);
+    n->key = newKey;
+    bucketAdd(h, n);
+}
+
+void radixDelete(RadixHeap* h, RadixNode* n) {
+    bucketRemove(h, n);
+    free(n);
+    h->size--;
+}
+
+void radixFree(RadixHeap* h) {
+    while (radixPop(h, NULL, NULL)) ;
+}
+
+// ---------------- Dijkstra benchmark ----------------
+typedef struct {
+    int n;
+    int* start;     // Edges of v: to[start[v] .. start[v+1]-1]
+    int* to;
+    int* weight;
+} Graph;
+
+unsigned int seed = 2463534242u;
+
+unsigned int nextRandom() {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+// Random graph: a ring (so everything is reachable) plus random edges
+Graph makeGraph(int n, int degree) {
+    Graph g;
+    g.n = n;
+    g.start = malloc((n + 1) * sizeof(int));
+    g.to = malloc((long)n * degree * sizeof(int));
+    g.weight = malloc((long)n * degree * sizeof(int));
+    for (int v = 0; v < n; v++) {
+        g.start[v] = v * degree;
+        g.to[v * degree] = (v + 1) % n;
+        g.weight[v * degree] = 1 + nextRandom() % 1000;
+        for (int e = 1; e < degree; e++) {
+            g.to[v * degree + e] = nextRandom() % n;
+            g.weight[v * degree + e] = 1 + nextRandom() % 1000;
+        }
+    }
+    g.start[n] = n * degree;
+    return g;
+}
+
+typedef struct {
+    int dist;
+    int vertex;
+} Entry;
+
+int compareEntry(const void* a, const void* b) {
+    int x = ((const Entry*)a)->dist, y = ((const Entry*)b)->dist;
+    return (y > x) - (y < x);   // Reversed: smallest distance on top
+}
+
+// No decrease-key: push a new entry every time, skip outdated ones
+long dijkstraLazy(Graph* g, int source, int dist[]) {
+    DaryHeap h;
+    heapInit(&h, sizeof(Entry), 4, compareEntry);
+    for (int v = 0; v < g->n; v++) dist[v] = INT_MAX;
+    dist[source] = 0;
+    Entry e = { 0, source };
+    heapPush(&h, &e);
+    long pushes = 1;
+    while (heapPop(&h, &e)) {
+        if (e.dist > dist[e.vertex]) continue;  // Stale entry
+        for (int i = g->start[e.vertex]; i < g->start[e.vertex + 1]; i++) {
+            int d = e.dist + g->weight[i];
+            if (d < dist[g->to[i]]) {
+                dist[g->to[i]] = d;
+                Entry next = { d, g->to[i] };
+                heapPush(&h, &next);
+                pushes++;
+            }
+        }
+    }
+    heapFree(&h);
+    return pushes;
+}
+
+// One node per vertex, so the handle of v is simply &nodes[v]
+long dijkstraPairing(Graph* g, int source, int dist[]) {
+    PairingHeap h;
+    pairingInit(&h);
+    PairNode* nodes = malloc(g->n * sizeof(PairNode));
+    char* queued = calloc(g->n, 1);
+    for (int v = 0; v < g->n; v++) dist[v] = INT_MAX;
+    dist[source] = 0;
+    pairingInsertNode(&h, &nodes[source], 0, source);
+    queued[source] = 1;
+    long decreases = 0;
+    PairNode* top;
+    while ((top = pairingPopNode(&h))) {
+        int u = top->value, d = top->key;
+        queued[u] = 0;
+        for (int i = g->start[u]; i < g->start[u + 1]; i++) {
+            int v = g->to[i];
+            if (d + g->weight[i] < dist[v]) {
+                dist[v] = d + g->weight[i];
+                if (queued[v]) { pairingDecreaseKey(&h, &nodes[v], dist[v]); decreases++; }
+                else { pairingInsertNode(&h, &nodes[v], dist[v], v); queued[v] = 1; }
+            }
+        }
+    }
+    free(nodes);
+    free(queued);
+    return decreases;
+}
+
+long dijkstraRadix(Graph* g, int source, int dist[]) {
+    RadixHeap h;
+    radixInit(&h);
+    RadixNode* nodes = malloc(g->n * sizeof(RadixNode));
+    char* queued = calloc(g->n, 1);
+    for (int v = 0; v < g->n; v++) dist[v] = INT_MAX;
+    dist[source] = 0;
+    radixInsertNode(&h, &nodes[source], 0, source);
+    queued[source] = 1;
+    long decreases = 0;
+    RadixNode* top;
+    while ((top = radixPopNode(&h))) {
+        int u = top->value, d = (int)top->key;
+        queued[u] = 0;
+        for (int i = g->start[u]; i < g->start[u + 1]; i++) {
+            int v = g->to[i];
+            if (d + g->weight[i] < dist[v]) {
+                dist[v] = d + g->weight[i];
+                if (queued[v]) { radixDecreaseKey(&h, &nodes[v], dist[v]); decreases++; }
+                else { radixInsertNode(&h, &nodes[v], dist[v], v); queued[v] = 1; }
+            }
+        }
+    }
+    free(nodes);
+    free(queued);
+    return decreases;
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int degree = argc > 2 ? atoi(argv[2]) : 8;
+
+    // Handles demo
+    PairingHeap ph;
+    pairingInit(&ph);
+    PairNode* jobs[6];
+    int priorities[] = { 50, 30, 80, 20, 60, 40 };
+    for (int i = 0; i < 6; i++) jobs[i] = pairingPush(&ph, priorities[i], i);
+    pairingDecreaseKey(&ph, jobs[2], 10);   // job 2: 80 -> 10
+    pairingDelete(&ph, jobs[4]);            // job 4 cancelled
+    printf("Pairing heap (job 2: 80 -> 10, job 4 deleted): ");
+    int key, value;
+    while (pairingPop(&ph, &key, &value)) printf("job%d(%d) ", value, key);
+    printf("\n");
+
+    RadixHeap rh;
+    radixInit(&rh);
+    RadixNode* items[6];
+    for (int i = 0; i < 6; i++) items[i] = radixPush(&rh, priorities[i], i);
+    radixDecreaseKey(&rh, items[2], 10);
+    radixDelete(&rh, items[4]);
+    printf("Radix heap   (same changes):                    ");
+    unsigned int ukey;
+    while (radixPop(&rh, &ukey, &value)) printf("job%d(%u) ", value, ukey);
+    printf("\n\n");
+
+    // Dijkstra
+    Graph g = makeGraph(n, degree);
+    int* distLazy = malloc(n * sizeof(int));
+    int* distPairing = malloc(n * sizeof(int));
+    int* distRadix = malloc(n * sizeof(int));
+
+    printf("Dijkstra: %d vertices, %d edges, weights 1..1000\n", n, n * degree);
+    printf("Queue                          | Time ms | Notes\n");
+    printf("-------------------------------+---------+-------------------------\n");
+    double t = nowSeconds();
+    long pushes = dijkstraLazy(&g, 0, distLazy);
+    printf("4-ary heap, duplicates (lazy)  | %7.0f | %ld pushes for %d vertices\n",
+           (nowSeconds() - t) * 1e3, pushes, n);
+    t = nowSeconds();
+    long decreases = dijkstraPairing(&g, 0, distPairing);
+    printf("pairing heap + decreaseKey     | %7.0f | %ld decrease-keys\n",
+           (nowSeconds() - t) * 1e3, decreases);
+    t = nowSeconds();
+    decreases = dijkstraRadix(&g, 0, distRadix);
+    printf("radix heap + decreaseKey       | %7.0f | %ld decrease-keys\n",
+           (nowSeconds() - t) * 1e3, decreases);
+
+    int same = 1;
+    for (int v = 0; v < n; v++)
+        if (distLazy[v] != distPairing[v] || distLazy[v] != distRadix[v]) same = 0;
+    printf("All three give the same distances: %s\n", same ? "yes" : "NO");
+
+    free(distLazy);
+    free(distPairing);
+    free(distRadix);
+    free(g.start);
+    free(g.to);
+    free(g.weight);
+    return 0;
+}
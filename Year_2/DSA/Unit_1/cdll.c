@@ -1,117 +1,97 @@
+// Circular doubly linked list on intrusive_list.c's DList, which is
+// already a ring: the sentinel sits between the last node and the first,
+// so traversal just stops when it gets back to it. Nodes come from a
+// NodePool and go back to it when deleted.
+//
+// Compile: gcc cdll.c intrusive_list.c -o cdll
+
 #include <stdio.h>
 #include <stdlib.h>
+#include "intrusive_list.h"
 
 struct Node {
     int data;
-    struct Node* next;
-    struct Node* prev;
+    DLink link;
 };
 
-void insert_end(struct Node** head, int val) {
-    struct Node* newnode = malloc(sizeof(struct Node));
-    newnode->data = val;
-    if (!(*head)) {
-        newnode->next = newnode->prev = newnode;
-        *head = newnode;
-        return;
+NodePool nodes;
+
+#define NODE(p) LIST_ENTRY(p, struct Node, link)
+
+struct Node* newNode(int val) {
+    struct Node* newnode = nodePoolGet(&nodes);
+    if (!newnode) {
+        printf("Out of memory\n");
+        exit(1);
     }
-    struct Node* last = (*head)->prev;
-    newnode->next = *head;
-    (*head)->prev = newnode;
-    newnode->prev = last;
-    last->next = newnode;
+    newnode->data = val;
+    return newnode;
 }
 
-void traverse(struct Node* head) {
-    if(!head) return;
-    struct Node* temp = head;
-    do {
-        printf("%d <-> ", temp->data);
-        temp = temp->next;
-    } while(temp != head);
-    printf("\n");
+void insert_end(DList* list, int val) {
+    dlistPushBack(list, &newNode(val)->link);
 }
 
-void delete_node(struct Node** head, int key) {
-    if (!*head) return;
-    struct Node *curr = *head, *prev = NULL;
-    do {
-        if (curr->data == key) {
-            if (curr->next == curr) { // only one node
-                free(curr);
-                *head = NULL;
-            } else {
-                if (prev) prev->next = curr->next;
-                curr->next->prev = curr->prev;
-                if (curr == *head) *head = curr->next; // update head if needed
-                free(curr);
-            }
-            return;
-        }
-        prev = curr;
-        curr = curr->next;
-    } while (curr != *head);
+void traverse(DList* list) {
+    if (!list->count) return;
+    for (DLink* p = DLIST_FIRST(list); p != DLIST_END(list); p = p->next)
+        printf("%d <-> ", NODE(p)->data);
+    printf("\n");
 }
 
-insert_at_position(struct Node** head, int val, int pos) {
-    struct Node* newnode = malloc(sizeof(struct Node));
-    newnode->data = val;
-    if (pos == 0) {
-        if (!(*head)) {
-            newnode->next = newnode->prev = newnode;
-            *head = newnode;
+void delete_node(DList* list, int key) {
+    for (DLink* p = DLIST_FIRST(list); p != DLIST_END(list); p = p->next) {
+        if (NODE(p)->data == key) {
+            dlistRemove(list, p);
+            nodePoolPut(&nodes, NODE(p));
             return;
         }
-        struct Node* last = (*head)->prev;
-        newnode->next = *head;
-        (*head)->prev = newnode;
-        newnode->prev = last;
-        last->next = newnode;
-        *head = newnode;
-        return;
     }
-    struct Node* temp = *head;
-    for (int i = 0; i < pos - 1; i++) {
-        temp = temp->next;
-        if (temp == *head) break; // position is out of bounds
-    }
-    newnode->next = temp->next;
-    newnode->prev = temp;
-    temp->next->prev = newnode;
-    temp->next = newnode;
+}
+
+// Position 0 is the front; a position past the end inserts at the end
+void insert_at_position(DList* list, int val, int pos) {
+    DLink* before = DLIST_END(list);
+    for (int i = 0; i < pos && before->next != DLIST_END(list); i++)
+        before = before->next;
+    dlistInsertAfter(list, before, &newNode(val)->link);
 }
 
 int main() {
-    struct Node* head = NULL;
+    DList list;
     int choice, val, pos;
+    dlistInit(&list);
+    nodePoolInit(&nodes, sizeof(struct Node));
     while (1) {
         printf("1. Insert at end\n2. Insert at position\n3. Delete node\n4. Traverse\n5. Exit\n");
         printf("Enter your choice: ");
-        scanf("%d", &choice);
+        if (scanf("%d", &choice) != 1) break;
         switch (choice) {
             case 1:
                 printf("Enter value to insert: ");
                 scanf("%d", &val);
-                insert_end(&head, val);
+                insert_end(&list, val);
                 break;
             case 2:
                 printf("Enter value and position to insert: ");
                 scanf("%d %d", &val, &pos);
-                insert_at_position(&head, val, pos);
+                insert_at_position(&list, val, pos);
                 break;
             case 3:
                 printf("Enter value to delete: ");
                 scanf("%d", &val);
-                delete_node(&head, val);
+                delete_node(&list, val);
                 break;
             case 4:
-                traverse(head);
+                traverse(&list);
                 break;
             case 5:
+                nodePoolDestroy(&nodes);
                 exit(0);
             default:
                 printf("Invalid choice\n");
         }
     }
+    nodePoolDestroy(&nodes);
     return 0;
 }
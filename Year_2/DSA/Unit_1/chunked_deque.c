@@ -0,0 +1,120 @@
+#include <stdlib.h>
+#include <string.h>
+#include "chunked_deque.h"
+
+// Think of the map as one long virtual array of mapSize << shift slots.
+// The elements are the positions first .. first+count-1 of that array;
+// only the chunks that hold at least one element are allocated.
+// When an end runs into the edge of the map, the map is rebuilt (twice
+// as big if it is more than half used) with the chunks in the middle,
+// so both ends get room to grow again.
+
+#define CHUNK_BYTES 1024
+#define MASK(d) (((size_t)1 << (d)->shift) - 1)
+#define AT(d, pos) ((d)->map[(pos) >> (d)->shift] + ((pos) & MASK(d)) * (d)->elemSize)
+
+int dequeInit(ChunkedDeque* d, size_t elemSize) {
+    // The chunk size loop below would never end for 0-byte elements
+    if (elemSize == 0)
+        return 0;
+    d->elemSize = elemSize;
+    d->shift = 0;
+    while (((size_t)2 << d->shift) * elemSize <= CHUNK_BYTES)
+        d->shift++;
+    d->mapSize = 8;
+    d->map = calloc(d->mapSize, sizeof(char*));
+    if (!d->map)
+        return 0;
+    d->first = (d->mapSize / 2) << d->shift;
+    d->count = 0;
+    return 1;
+}
+
+void dequeFree(ChunkedDeque* d) {
+    for (size_t i = 0; i < d->mapSize; i++)
+        free(d->map[i]);
+    free(d->map);
+    d->map = NULL;
+    d->mapSize = d->count = 0;
+}
+
+size_t dequeSize(const ChunkedDeque* d) {
+    return d->count;
+}
+
+// Make room for one more chunk at either end
+static void rebuildMap(ChunkedDeque* d) {
+    size_t firstChunk = d->first >> d->shift;
+    size_t used = d->count ? ((d->first + d->count - 1) >> d->shift) - firstChunk + 1 : 0;
+    size_t newSize = d->mapSize;
+    if (2 * (used + 1) > newSize)
+        newSize *= 2;
+    size_t start = (newSize - used) / 2;
+
+    char** newMap = calloc(newSize, sizeof(char*));
+    memcpy(newMap + start, d->map + firstChunk, used * sizeof(char*));
+    free(d->map);
+    d->map = newMap;
+    d->mapSize = newSize;
+    d->first = (start << d->shift) + (d->first & MASK(d));
+}
+
+void dequePushBack(ChunkedDeque* d, const void* elem) {
+    size_t pos = d->first + d->count;
+    if (pos == d->mapSize << d->shift) {
+        rebuildMap(d);
+        pos = d->first + d->count;
+    }
+    if (d->count == 0 || (pos & MASK(d)) == 0)
+        d->map[pos >> d->shift] = malloc(d->elemSize << d->shift);
+    memcpy(AT(d, pos), elem, d->elemSize);
+    d->count++;
+}
+
+void dequePushFront(ChunkedDeque* d, const void* elem) {
+    if (d->first == 0)
+        rebuildMap(d);
+    size_t pos = d->first - 1;
+    if (d->count == 0 || (pos & MASK(d)) == MASK(d))
+        d->map[pos >> d->shift] = malloc(d->elemSize << d->shift);
+    memcpy(AT(d, pos), elem, d->elemSize);
+    d->first = pos;
+    d->count++;
+}
+
+int dequePopFront(ChunkedDeque* d, void* out) {
+    if (d->count == 0)
+        return 0;
+    size_t pos = d->first;
+    if (out)
+        memcpy(out, AT(d, pos), d->elemSize);
+    d->first++;
+    d->count--;
+    // Last element of its chunk gone: release the chunk
+    if (d->count == 0 || (d->first & MASK(d)) == 0) {
+        free(d->map[pos >> d->shift]);
+        d->map[pos >> d->shift] = NULL;
+    }
+    return 1;
+}
+
+int dequePopBack(ChunkedDeque* d, void* out) {
+    if (d->count == 0)
+        return 0;
+    size_t pos = d->first + d->count - 1;
+    if (out)
+        memcpy(out, AT(d, pos), d->elemSize);
+    d->count--;
+    if (d->count == 0 || (pos & MASK(d)) == 0) {
+        free(d->map[pos >> d->shift]);
+        d->map[pos >> d->shift] = NULL;
+    }
+    return 1;
+}
+
+void* dequeAt(const ChunkedDeque* d, size_t i) {
+    if (i >= d->count)
+        return NULL;
+    size_t pos = d->first + i;
+    return AT(d, pos);
+}
@@ -0,0 +1,33 @@
+#ifndef CHUNKED_DEQUE_H
+#define CHUNKED_DEQUE_H
+
+#include <stddef.h>
+
+// Double-ended queue of any element type that never gets full.
+// Elements live in fixed-size chunks; a central "map" array holds the
+// chunk pointers in order (the layout of C++ std::deque).
+// - push/pop at either end: O(1) amortized; growing only reallocates
+//   the small map, elements are never copied or moved
+// - dequeAt(i): O(1), two array lookups
+// Pointers from dequeAt stay valid while you push or pop at the ends,
+// except for the element that gets popped.
+
+typedef struct {
+    char** map;             // chunk pointers, NULL outside the used range
+    size_t mapSize;         // slots in map
+    size_t first;           // position of the front element (chunk = first >> shift)
+    size_t count;
+    size_t elemSize;
+    unsigned shift;         // elements per chunk = 1 << shift
+} ChunkedDeque;
+
+int dequeInit(ChunkedDeque* d, size_t elemSize);     // 0 if elemSize is 0 or out of memory
+void dequeFree(ChunkedDeque* d);
+size_t dequeSize(const ChunkedDeque* d);
+void dequePushFront(ChunkedDeque* d, const void* elem);
+void dequePushBack(ChunkedDeque* d, const void* elem);
+int dequePopFront(ChunkedDeque* d, void* out);  // 0 if empty, out may be NULL
+int dequePopBack(ChunkedDeque* d, void* out);   // 0 if empty, out may be NULL
+void* dequeAt(const ChunkedDeque* d, size_t i); // NULL if i >= size
+
+#endif
@@ -0,0 +1,194 @@
+// Benchmark for chunked_deque.c against the doubly linked list the
+// original dll_operation.c used (same struct Node, one malloc per element).
+// Its insert_end walked the whole list every time, so the
+// list here also keeps a tail pointer to give it O(1) ends; the original
+// insert_end is only timed for small n.
+//
+// Compile: gcc -O2 chunked_deque_bench.c chunked_deque.c -o dequebench
+// Run:     ./dequebench [elements]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "chunked_deque.h"
+
+struct Node {
+    int data;
+    struct Node *prev, *next;
+};
+
+typedef struct {
+    struct Node *head, *tail;
+} List;
+
+void listPushFront(List* l, int val) {
+    struct Node* newnode = malloc(sizeof(struct Node));
+    newnode->data = val;
+    newnode->prev = NULL;
+    newnode->next = l->head;
+    if (l->head) l->head->prev = newnode;
+    else l->tail = newnode;
+    l->head = newnode;
+}
+
+void listPushBack(List* l, int val) {
+    struct Node* newnode = malloc(sizeof(struct Node));
+    newnode->data = val;
+    newnode->next = NULL;
+    newnode->prev = l->tail;
+    if (l->tail) l->tail->next = newnode;
+    else l->head = newnode;
+    l->tail = newnode;
+}
+
+int listPopFront(List* l) {
+    struct Node* temp = l->head;
+    int val = temp->data;
+    l->head = temp->next;
+    if (l->head) l->head->prev = NULL;
+    else l->tail = NULL;
+    free(temp);
+    return val;
+}
+
+int listPopBack(List* l) {
+    struct Node* temp = l->tail;
+    int val = temp->data;
+    l->tail = temp->prev;
+    if (l->tail) l->tail->next = NULL;
+    else l->head = NULL;
+    free(temp);
+    return val;
+}
+
+// The original dll_operation.c's insert_end (now on intrusive_list.c)
+void insert_end(struct Node** head, int val) {
+    struct Node* newnode = malloc(sizeof(struct Node));
+    newnode->data = val;
+    newnode->next = NULL;
+    if (!*head) {
+        newnode->prev = NULL;
+        *head = newnode;
+        return;
+    }
+    struct Node* temp = *head;
+    while (temp->next) temp = temp->next;
+    temp->next = newnode;
+    newnode->prev = temp;
+}
+
+// Order-sensitive checksum: the same values in another order give
+// another result, so "Same" also catches elements that come out swapped
+unsigned long long addToChecksum(unsigned long long sum, int value) {
+    return sum * 1000003u + (unsigned int)value;
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[]) {
+    long n = argc > 1 ? atol(argv[1]) : 10000000;
+
+    // Demo: no "Deque is full" any more
+    ChunkedDeque demo;
+    if (!dequeInit(&demo, sizeof(int))) return 1;
+    for (int i = 1; i <= 5; i++) dequePushBack(&demo, &i);
+    for (int i = 0; i >= -4; i--) dequePushFront(&demo, &i);
+    printf("Deque of %zu:", dequeSize(&demo));
+    for (size_t i = 0; i < dequeSize(&demo); i++) printf(" %d", *(int*)dequeAt(&demo, i));
+    int front, back;
+    dequePopFront(&demo, &front);
+    dequePopBack(&demo, &back);
+    printf("\nPopped front %d and back %d, element 3 is now %d\n\n", front, back, *(int*)dequeAt(&demo, 3));
+    dequeFree(&demo);
+
+    printf("%ld ints, ns per element\n", n);
+    printf("Operation                   | Chunked deque | Linked list | Same\n");
+    printf("----------------------------+---------------+-------------+-----\n");
+
+    ChunkedDeque d;
+    List l = { NULL, NULL };
+    if (!dequeInit(&d, sizeof(int))) return 1;
+
+    // Half pushed at each end
+    double t = nowSeconds();
+    for (int i = 0; i < n; i++) {
+        if (i & 1) dequePushBack(&d, &i);
+        else dequePushFront(&d, &i);
+    }
+    double deque = nowSeconds() - t;
+    t = nowSeconds();
+    for (int i = 0; i < n; i++) {
+        if (i & 1) listPushBack(&l, i);
+        else listPushFront(&l, i);
+    }
+    double list = nowSeconds() - t;
+    printf("%-27s | %13.2f | %11.2f |\n", "push front/back", deque / n * 1e9, list / n * 1e9);
+
+    // Front to back iteration
+    unsigned long long sumDeque = 0, sumList = 0;
+    t = nowSeconds();
+    for (size_t i = 0; i < dequeSize(&d); i++) sumDeque = addToChecksum(sumDeque, *(int*)dequeAt(&d, i));
+    deque = nowSeconds() - t;
+    t = nowSeconds();
+    for (struct Node* p = l.head; p; p = p->next) sumList = addToChecksum(sumList, p->data);
+    list = nowSeconds() - t;
+    printf("%-27s | %13.2f | %11.2f | %s\n", "iterate", deque / n * 1e9, list / n * 1e9,
+           sumDeque == sumList ? "yes" : "NO");
+
+    // Random access: the list has to walk, so only a few lookups
+    long lookups = 1000;
+    unsigned int seed = 2463534242u;
+    unsigned long long pickedDeque = 0, pickedList = 0;
+    t = nowSeconds();
+    for (long k = 0; k < lookups; k++) {
+        seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+        pickedDeque = addToChecksum(pickedDeque, *(int*)dequeAt(&d, seed % n));
+    }
+    deque = nowSeconds() - t;
+    seed = 2463534242u;
+    t = nowSeconds();
+    for (long k = 0; k < lookups; k++) {
+        seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+        struct Node* p = l.head;
+        for (unsigned int s = seed % n; s > 0; s--) p = p->next;
+        pickedList = addToChecksum(pickedList, p->data);
+    }
+    list = nowSeconds() - t;
+    printf("%-27s | %13.2f | %11.0f | %s\n", "random index (per lookup)", deque / lookups * 1e9,
+           list / lookups * 1e9, pickedDeque == pickedList ? "yes" : "NO");
+
+    // Pop everything, alternating ends; both must pop the same sequence
+    sumDeque = sumList = 0;
+    t = nowSeconds();
+    for (long i = 0; i < n; i++) {
+        int v;
+        if (i & 1) dequePopBack(&d, &v);
+        else dequePopFront(&d, &v);
+        sumDeque = addToChecksum(sumDeque, v);
+    }
+    deque = nowSeconds() - t;
+    t = nowSeconds();
+    for (long i = 0; i < n; i++) sumList = addToChecksum(sumList, (i & 1) ? listPopBack(&l) : listPopFront(&l));
+    list = nowSeconds() - t;
+    int same = sumDeque == sumList && dequeSize(&d) == 0 && l.head == NULL;
+    printf("%-27s | %13.2f | %11.2f | %s\n", "pop front/back", deque / n * 1e9, list / n * 1e9,
+           same ? "yes" : "NO");
+    dequeFree(&d);
+
+    // The original O(n) insert_end, for scale
+    long small = n < 20000 ? n : 20000;
+    struct Node* head = NULL;
+    t = nowSeconds();
+    for (int i = 0; i < small; i++) insert_end(&head, i);
+    printf("\nOriginal insert_end for %ld elements: %.2f ns each\n", small, (nowSeconds() - t) / small * 1e9);
+    while (head) {
+        struct Node* next = head->next;
+        free(head);
+        head = next;
+    }
+    return 0;
+}
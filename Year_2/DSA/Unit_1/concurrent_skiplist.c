@@ -0,0 +1,652 @@
+// Lock-free concurrent skip list (search, insert, delete, range iteration)
+//
+// Differences from skiplist_operations.c:
+// - No fixed MAXLVL: the level cap grows with the element count
+//   (about log2(count) levels, up to MAX_HEIGHT = 32)
+// - Nodes store their forward pointers inline (one malloc per node)
+// - Safe to call from many threads at once without any lock
+//
+// How it stays correct without locks:
+// - Every forward pointer is changed with compare-and-swap (CAS)
+// - Delete first MARKS the node's own forward pointers (lowest bit = 1),
+//   top level first. A marked pointer can never be CAS'd again, so
+//   nobody can link a new node after a node that is being deleted.
+// - Marking level 0 is the moment the key is deleted. After that any
+//   thread that walks past the node unlinks ("snips") it.
+// - Insert links level 0 first (the moment the key exists), then the
+//   upper levels, which are only shortcuts.
+//
+// Memory: another thread may still be reading a deleted node, so it
+// cannot be freed right away. Epoch based reclamation, as in Unit_3's
+// threaded_bst_concurrent.c, but every thread may delete:
+// - Each thread has a slot (tid 0 .. MAX_THREADS-1, passed to every
+//   call). On the way in it copies the global epoch into its slot,
+//   on the way out it clears it.
+// - A deleted node goes on the deleting thread's own limbo list,
+//   tagged with the global epoch read AFTER it was unlinked.
+// - The epoch moves from e to e+1 only when every thread inside is in
+//   e. So once it reaches tag + 2, everyone who could have seen the
+//   node has left, and the owner frees the list.
+// - A node still being linked into its upper levels can be linked
+//   again after the deleter unlinked it. So inserter and deleter each
+//   drop a reference when they are done, and the last one retires it.
+//
+// Compile: gcc -O2 -pthread concurrent_skiplist.c ../common/skiplist_common.c -o cskip
+// Run:     ./cskip [initialKeys] [secondsPerRun] [maxThreads]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+#include "../common/skiplist_common.h"
+
+#define MAX_HEIGHT 32
+#define MARK 1
+#define MAX_THREADS 64
+#define RETIRE_BATCH 64                 // Try to advance the epoch this often
+
+typedef struct snode {
+    int key;
+    int value;
+    int height;
+    atomic_int owners;                  // Inserter + deleter; the last to let go retires
+    struct snode* retiredNext;          // Link in a limbo list
+    _Atomic(uintptr_t) forward[];       // height pointers, lowest bit = mark
+} snode;
+
+// Written only by its own thread, except epoch (read by everyone)
+typedef struct {
+    _Alignas(64) atomic_ulong epoch;    // 0 = not inside the list
+    snode* limbo[3];                    // Deleted nodes, by tag % 3
+    unsigned long limboEpoch[3];        // Tag of the nodes in limbo[i]
+    int retiredSinceAdvance;
+    atomic_long allocated, freed;       // Node counts, for checking reclamation
+} EpochSlot;
+
+typedef struct skiplist {
+    snode* header;
+    atomic_int levelCap;                // New nodes get at most this many levels
+    atomic_long count;
+    atomic_ulong globalEpoch;
+    EpochSlot slots[MAX_THREADS];
+} skiplist;
+
+snode* ptrOf(uintptr_t link) { return (snode*)(link & ~(uintptr_t)MARK); }
+int isMarked(uintptr_t link) { return (int)(link & MARK); }
+
+snode* createNode(int key, int value, int height) {
+    snode* n = malloc(sizeof(snode) + height * sizeof(_Atomic(uintptr_t)));
+    n->key = key;
+    n->value = value;
+    n->height = height;
+    atomic_init(&n->owners, 2);
+    n->retiredNext = NULL;
+    for (int i = 0; i < height; i++)
+        atomic_init(&n->forward[i], (uintptr_t)0);
+    return n;
+}
+
+skiplist* createList() {
+    skiplist* list = malloc(sizeof(skiplist));
+    list->header = createNode(INT_MIN, 0, MAX_HEIGHT);
+    atomic_init(&list->levelCap, 1);
+    atomic_init(&list->count, 0);
+    atomic_init(&list->globalEpoch, 1);
+    for (int i = 0; i < MAX_THREADS; i++) {
+        EpochSlot* slot = &list->slots[i];
+        atomic_init(&slot->epoch, 0);
+        for (int j = 0; j < 3; j++) {
+            slot->limbo[j] = NULL;
+            slot->limboEpoch[j] = 0;
+        }
+        slot->retiredSinceAdvance = 0;
+        atomic_init(&slot->allocated, 0);
+        atomic_init(&slot->freed, 0);
+    }
+    return list;
+}
+
+// Free one limbo list, returns how many nodes it held
+long freeLimbo(snode* x) {
+    long freed = 0;
+    while (x) {
+        snode* next = x->retiredNext;
+        free(x);
+        x = next;
+        freed++;
+    }
+    return freed;
+}
+
+void destroyList(skiplist* list) {
+    snode* x = ptrOf(atomic_load(&list->header->forward[0]));
+    while (x) {
+        snode* next = ptrOf(atomic_load(&x->forward[0]));
+        free(x);
+        x = next;
+    }
+    for (int i = 0; i < MAX_THREADS; i++)
+        for (int j = 0; j < 3; j++)
+            freeLimbo(list->slots[i].limbo[j]);
+    free(list->header);
+    free(list);
+}
+
+// ---------------- Epochs ----------------
+
+// Free this thread's limbo lists whose tag is at least 2 epochs old
+void freeOldLimbo(EpochSlot* slot, unsigned long epoch) {
+    for (int j = 0; j < 3; j++) {
+        if (slot->limbo[j] && slot->limboEpoch[j] + 2 <= epoch) {
+            atomic_fetch_add_explicit(&slot->freed, freeLimbo(slot->limbo[j]), memory_order_relaxed);
+            slot->limbo[j] = NULL;
+        }
+    }
+}
+
+// The fence makes sure a thread advancing the epoch either sees our
+// slot, or we see every unlink done before it looked at the slots
+void enterList(skiplist* list, int tid) {
+    EpochSlot* slot = &list->slots[tid];
+    unsigned long e = atomic_load(&list->globalEpoch);
+    atomic_store(&slot->epoch, e);
+    atomic_thread_fence(memory_order_seq_cst);
+    freeOldLimbo(slot, e);
+}
+
+void exitList(skiplist* list, int tid) {
+    atomic_store_explicit(&list->slots[tid].epoch, 0, memory_order_release);
+}
+
+void tryAdvanceEpoch(skiplist* list) {
+    unsigned long e = atomic_load(&list->globalEpoch);
+    atomic_thread_fence(memory_order_seq_cst);
+    for (int i = 0; i < MAX_THREADS; i++) {
+        unsigned long seen = atomic_load(&list->slots[i].epoch);
+        if (seen != 0 && seen != e)
+            return;                     // Someone is still in an older epoch
+    }
+    atomic_compare_exchange_strong(&list->globalEpoch, &e, e + 1);
+}
+
+// x is unlinked from every level and nobody will link it again
+void retireNode(skiplist* list, int tid, snode* x) {
+    EpochSlot* slot = &list->slots[tid];
+    atomic_thread_fence(memory_order_seq_cst);
+    unsigned long tag = atomic_load(&list->globalEpoch);
+    int j = (int)(tag % 3);
+    if (slot->limboEpoch[j] != tag) {
+        // Holds tag - 3 or older: already safe
+        atomic_fetch_add_explicit(&slot->freed, freeLimbo(slot->limbo[j]), memory_order_relaxed);
+        slot->limbo[j] = NULL;
+        slot->limboEpoch[j] = tag;
+    }
+    x->retiredNext = slot->limbo[j];
+    slot->limbo[j] = x;
+
+    if (++slot->retiredSinceAdvance >= RETIRE_BATCH) {
+        slot->retiredSinceAdvance = 0;
+        tryAdvanceEpoch(list);
+        freeOldLimbo(slot, atomic_load(&list->globalEpoch));
+    }
+}
+
+void releaseNode(skiplist* list, int tid, snode* x) {
+    if (atomic_fetch_sub(&x->owners, 1) == 1)
+        retireNode(list, tid, x);
+}
+
+// Only while no other thread uses the list: advance until every
+// limbo list is old enough, then free them all
+void collectGarbage(skiplist* list) {
+    for (int round = 0; round < 3; round++)
+        tryAdvanceEpoch(list);
+    unsigned long e = atomic_load(&list->globalEpoch);
+    for (int i = 0; i < MAX_THREADS; i++)
+        freeOldLimbo(&list->slots[i], e);
+}
+
+// Nodes allocated and not yet freed (header not counted)
+long liveNodes(skiplist* list) {
+    long live = 0;
+    for (int i = 0; i < MAX_THREADS; i++)
+        live += atomic_load_explicit(&list->slots[i].allocated, memory_order_relaxed)
+              - atomic_load_explicit(&list->slots[i].freed, memory_order_relaxed);
+    return live;
+}
+
+// Levels 1 .. cap, P = 0.5 (skipRandomLevel in skiplist_common.c)
+int randomLevel(skiplist* list) {
+    int cap = atomic_load_explicit(&list->levelCap, memory_order_relaxed);
+    return 1 + skipRandomLevel(cap - 1, 1);
+}
+
+// Keep about log2(count) levels: grow the cap as the list grows
+void growLevelCap(skiplist* list, long count) {
+    int cap = atomic_load(&list->levelCap);
+    while (cap < MAX_HEIGHT && (1L << cap) < count) {
+        if (atomic_compare_exchange_weak(&list->levelCap, &cap, cap + 1))
+            cap++;
+    }
+}
+
+// Fill preds/succs around key on every level, snipping marked nodes.
+// Returns 1 if an unmarked node with this key is in the list.
+int find(skiplist* list, int key, snode* preds[], snode* succs[]) {
+retry:;
+    int top = atomic_load(&list->levelCap) - 1;
+    snode* pred = list->header;
+    snode* curr = NULL;
+    for (int i = top; i >= 0; i--) {
+        curr = ptrOf(atomic_load(&pred->forward[i]));
+        while (curr) {
+            uintptr_t succ = atomic_load(&curr->forward[i]);
+            if (isMarked(succ)) {
+                // curr is being deleted: unlink it on this level
+                uintptr_t expected = (uintptr_t)curr;
+                if (!atomic_compare_exchange_strong(&pred->forward[i], &expected, (uintptr_t)ptrOf(succ)))
+                    goto retry;             // pred changed or got marked
+                curr = ptrOf(succ);
+                continue;
+            }
+            if (curr->key < key) {
+                pred = curr;
+                curr = ptrOf(succ);
+            } else {
+                break;
+            }
+        }
+        preds[i] = pred;
+        succs[i] = curr;
+    }
+    return curr && curr->key == key;
+}
+
+// Returns 1 and sets *value if key is present. Never writes to the list.
+int search(skiplist* list, int tid, int key, int* value) {
+    enterList(list, tid);
+    snode* pred = list->header;
+    snode* curr = NULL;
+    for (int i = atomic_load(&list->levelCap) - 1; i >= 0; i--) {
+        curr = ptrOf(atomic_load(&pred->forward[i]));
+        while (curr) {
+            uintptr_t succ = atomic_load(&curr->forward[i]);
+            if (isMarked(succ)) {           // Step over deleted nodes
+                curr = ptrOf(succ);
+                continue;
+            }
+            if (curr->key < key) {
+                pred = curr;
+                curr = ptrOf(succ);
+            } else {
+                break;
+            }
+        }
+    }
+    int found = curr && curr->key == key && !isMarked(atomic_load(&curr->forward[0]));
+    if (found && value) *value = curr->value;
+    exitList(list, tid);
+    return found;
+}
+
+// Returns 1 if inserted, 0 if the key was already there
+int insert(skiplist* list, int tid, int key, int value) {
+    snode* preds[MAX_HEIGHT];
+    snode* succs[MAX_HEIGHT];
+    int height = randomLevel(list);
+    snode* x;
+
+    enterList(list, tid);
+    while (1) {
+        if (find(list, key, preds, succs)) {
+            exitList(list, tid);
+            return 0;
+        }
+        x = createNode(key, value, height);
+        for (int i = 0; i < height; i++)
+            atomic_store_explicit(&x->forward[i], (uintptr_t)succs[i], memory_order_relaxed);
+
+        // Level 0 decides: after this CAS the key is in the list
+        uintptr_t expected = (uintptr_t)succs[0];
+        if (atomic_compare_exchange_strong(&preds[0]->forward[0], &expected, (uintptr_t)x))
+            break;
+        free(x);                            // Nobody saw it, try again
+    }
+    atomic_fetch_add_explicit(&list->slots[tid].allocated, 1, memory_order_relaxed);
+
+    // Upper levels are only shortcuts: link them one by one
+    for (int i = 1; i < height; i++) {
+        while (1) {
+            uintptr_t mine = atomic_load(&x->forward[i]);
+            if (isMarked(mine))
+                goto done;                  // Already being deleted
+            if (ptrOf(mine) != succs[i] &&
+                !atomic_compare_exchange_strong(&x->forward[i], &mine, (uintptr_t)succs[i]))
+                continue;
+            uintptr_t expected = (uintptr_t)succs[i];
+            if (atomic_compare_exchange_strong(&preds[i]->forward[i], &expected, (uintptr_t)x))
+                break;
+            find(list, key, preds, succs);  // Neighbours changed, look again
+            if (succs[0] != x)
+                goto done;                  // Deleted meanwhile
+        }
+    }
+done:
+    growLevelCap(list, atomic_fetch_add(&list->count, 1) + 1);
+    // Deleted while we were linking? Our last links may have gone in
+    // after the deleter's snip: snip again before letting go
+    if (isMarked(atomic_load(&x->forward[0])))
+        find(list, key, preds, succs);
+    releaseNode(list, tid, x);
+    exitList(list, tid);
+    return 1;
+}
+
+// Returns 1 if this call deleted the key
+int delete(skiplist* list, int tid, int key) {
+    snode* preds[MAX_HEIGHT];
+    snode* succs[MAX_HEIGHT];
+    enterList(list, tid);
+    if (!find(list, key, preds, succs)) {
+        exitList(list, tid);
+        return 0;
+    }
+    snode* victim = succs[0];
+
+    // Mark upper levels top-down so no new links can go after victim
+    for (int i = victim->height - 1; i >= 1; i--) {
+        uintptr_t succ = atomic_load(&victim->forward[i]);
+        while (!isMarked(succ))
+            atomic_compare_exchange_weak(&victim->forward[i], &succ, succ | MARK);
+    }
+
+    // Whoever marks level 0 owns the delete
+    uintptr_t succ = atomic_load(&victim->forward[0]);
+    while (1) {
+        if (isMarked(succ)) {
+            exitList(list, tid);
+            return 0;                       // Another thread won
+        }
+        if (atomic_compare_exchange_weak(&victim->forward[0], &succ, succ | MARK))
+            break;
+    }
+
+    find(list, key, preds, succs);          // Snip it out of every level
+    atomic_fetch_sub(&list->count, 1);
+    releaseNode(list, tid, victim);
+    exitList(list, tid);
+    return 1;
+}
+
+// Range iteration: seek to the first key >= low, then next() up to high.
+// Keys come out in increasing order; keys changed during the walk may
+// or may not be seen (like any concurrent iterator).
+// The whole walk is one stay inside the list: it ends when next()
+// returns 0, or call stopIteration to leave early.
+typedef struct {
+    skiplist* list;
+    int tid;
+    snode* current;
+    int high;
+} SkipIterator;
+
+void seek(skiplist* list, int tid, SkipIterator* it, int low, int high) {
+    enterList(list, tid);
+    it->list = list;
+    it->tid = tid;
+    snode* pred = list->header;
+    for (int i = atomic_load(&list->levelCap) - 1; i >= 0; i--) {
+        snode* curr = ptrOf(atomic_load(&pred->forward[i]));
+        while (curr && curr->key < low) {
+            pred = curr;
+            curr = ptrOf(atomic_load(&curr->forward[i]));
+        }
+    }
+    it->current = pred;
+    it->high = high;
+}
+
+void stopIteration(SkipIterator* it) {
+    if (it->current) {
+        exitList(it->list, it->tid);
+        it->current = NULL;
+    }
+}
+
+int next(SkipIterator* it, int* key, int* value) {
+    while (it->current) {
+        snode* x = ptrOf(atomic_load(&it->current->forward[0]));
+        if (!x || x->key > it->high) {
+            stopIteration(it);
+            return 0;
+        }
+        it->current = x;
+        if (!isMarked(atomic_load(&x->forward[0]))) {
+            *key = x->key;
+            *value = x->value;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Benchmark: mixed search/insert/delete on random keys
+typedef struct {
+    skiplist* list;
+    pthread_mutex_t* lock;      // NULL = lock-free, else one global lock
+    int keyRange;
+    int searchPercent;
+    atomic_int* stop;
+    long ops;
+    unsigned int seed;
+    int tid;
+} WorkerArgs;
+
+void* worker(void* arg) {
+    WorkerArgs* w = arg;
+    unsigned int s = w->seed;
+    long ops = 0;
+    int value;
+    while (!atomic_load_explicit(w->stop, memory_order_relaxed)) {
+        s ^= s << 13; s ^= s >> 17; s ^= s << 5;
+        int key = (int)(s % (unsigned int)w->keyRange);
+        int roll = (int)((s >> 8) % 100);
+        if (w->lock) pthread_mutex_lock(w->lock);
+        if (roll < w->searchPercent) search(w->list, w->tid, key, &value);
+        else if (roll % 2) insert(w->list, w->tid, key, key);
+        else delete(w->list, w->tid, key);
+        if (w->lock) pthread_mutex_unlock(w->lock);
+        ops++;
+    }
+    w->ops = ops;
+    return NULL;
+}
+
+// Each thread inserts its own keys, then deletes the odd ones
+typedef struct {
+    skiplist* list;
+    int first, step, n;
+} CheckArgs;
+
+void* checkWorker(void* arg) {
+    CheckArgs* c = arg;
+    for (int k = c->first; k < c->n; k += c->step)
+        insert(c->list, c->first, k, k);
+    for (int k = c->first; k < c->n; k += c->step)
+        if (k % 2) delete(c->list, c->first, k);
+    return NULL;
+}
+
+int concurrentCheck(int threads, int n) {
+    skiplist* list = createList();
+    pthread_t tids[MAX_THREADS];
+    CheckArgs args[MAX_THREADS];
+    for (int i = 0; i < threads; i++) {
+        args[i] = (CheckArgs){ list, i, threads, n };
+        pthread_create(&tids[i], NULL, checkWorker, &args[i]);
+    }
+    for (int i = 0; i < threads; i++)
+        pthread_join(tids[i], NULL);
+
+    // Exactly the even keys must be left, in order
+    SkipIterator it;
+    int key, value, expect = 0, ok = 1;
+    seek(list, 0, &it, 0, n);
+    while (next(&it, &key, &value)) {
+        if (key != expect) ok = 0;
+        expect += 2;
+    }
+    if (expect < n || atomic_load(&list->count) != (n + 1) / 2) ok = 0;
+    destroyList(list);
+    return ok;
+}
+
+// Churn: insert and delete over a small key range for a long time.
+// Without reclamation every delete would leave a node behind; with it
+// the nodes waiting in limbo stay a small, bounded number.
+typedef struct {
+    skiplist* list;
+    int tid, keyRange, rounds;
+    long deletes, maxWaiting;
+} ChurnArgs;
+
+void* churnWorker(void* arg) {
+    ChurnArgs* c = arg;
+    unsigned int s = 2654435761u * (c->tid + 1);
+    for (int r = 0; r < c->rounds; r++) {
+        s ^= s << 13; s ^= s >> 17; s ^= s << 5;
+        int key = (int)(s % (unsigned int)c->keyRange);
+        if (insert(c->list, c->tid, key, key) == 0)
+            c->deletes += delete(c->list, c->tid, key);
+        if (r % 1024 == 0) {
+            long waiting = liveNodes(c->list) - atomic_load(&c->list->count);
+            if (waiting > c->maxWaiting) c->maxWaiting = waiting;
+        }
+    }
+    return NULL;
+}
+
+int churnCheck(int threads, int keyRange, int rounds) {
+    skiplist* list = createList();
+    pthread_t tids[MAX_THREADS];
+    ChurnArgs args[MAX_THREADS];
+    for (int i = 0; i < threads; i++) {
+        args[i] = (ChurnArgs){ list, i, keyRange, rounds, 0, 0 };
+        pthread_create(&tids[i], NULL, churnWorker, &args[i]);
+    }
+    long deletes = 0, maxWaiting = 0;
+    for (int i = 0; i < threads; i++) {
+        pthread_join(tids[i], NULL);
+        deletes += args[i].deletes;
+        if (args[i].maxWaiting > maxWaiting) maxWaiting = args[i].maxWaiting;
+    }
+    long count = atomic_load(&list->count);
+    long liveAfter = liveNodes(list);
+    collectGarbage(list);
+    long liveCollected = liveNodes(list);
+    printf("Churn: %d threads, %ld deletes over %d keys\n", threads, deletes, keyRange);
+    printf("  live nodes: %ld in list, at most %ld waiting in limbo, %ld live after the run, %ld after collecting\n",
+           count, maxWaiting, liveAfter, liveCollected);
+    destroyList(list);
+    // Waiting nodes must be a small fraction of the deletes, and
+    // nothing but the list itself may be left once collected
+    return maxWaiting < deletes / 10 && liveCollected == count;
+}
+
+double runMix(int initialKeys, int threads, int searchPercent, double seconds, int useLock) {
+    skiplist* list = createList();
+    int keyRange = 2 * initialKeys;     // Inserts and deletes balance out at ~half full
+    for (int i = 0; i < keyRange; i += 2)
+        insert(list, 0, i, i);
+
+    pthread_mutex_t lock;
+    pthread_mutex_init(&lock, NULL);
+    atomic_int stop;
+    atomic_init(&stop, 0);
+    pthread_t* tids = malloc(threads * sizeof(pthread_t));
+    WorkerArgs* args = malloc(threads * sizeof(WorkerArgs));
+    for (int i = 0; i < threads; i++) {
+        args[i] = (WorkerArgs){ list, useLock ? &lock : NULL, keyRange, searchPercent,
+                                &stop, 0, 2654435761u * (i + 1), i };
+        pthread_create(&tids[i], NULL, worker, &args[i]);
+    }
+
+    struct timespec pause = { (time_t)seconds, (long)((seconds - (time_t)seconds) * 1e9) };
+    nanosleep(&pause, NULL);
+    atomic_store(&stop, 1);
+
+    long total = 0;
+    for (int i = 0; i < threads; i++) {
+        pthread_join(tids[i], NULL);
+        total += args[i].ops;
+    }
+    free(tids);
+    free(args);
+    pthread_mutex_destroy(&lock);
+    destroyList(list);
+    return total / seconds / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+    int initialKeys = argc > 1 ? atoi(argv[1]) : 1000000;
+    double seconds = argc > 2 ? atof(argv[2]) : 1.0;
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int maxThreads = argc > 3 ? atoi(argv[3]) : (int)(cores < 1 ? 1 : cores);
+    if (maxThreads < 1) maxThreads = 1;
+    if (maxThreads > MAX_THREADS) maxThreads = MAX_THREADS;
+
+    // Single-threaded demo
+    skiplist* list = createList();
+    int keys[] = {30, 10, 50, 20, 40, 70, 60};
+    for (int i = 0; i < 7; i++)
+        insert(list, 0, keys[i], keys[i] * 10);
+    int value;
+    printf("search(40): %s", search(list, 0, 40, &value) ? "found" : "not found");
+    printf(" (value %d)\n", value);
+    int deleted = delete(list, 0, 40);
+    printf("delete(40): %d, search(40): %s\n", deleted,
+           search(list, 0, 40, &value) ? "found" : "not found");
+    printf("range [15, 60]: ");
+    SkipIterator it;
+    int key;
+    seek(list, 0, &it, 15, 60);
+    while (next(&it, &key, &value))
+        printf("%d ", key);
+    printf("\n");
+    destroyList(list);
+
+    // Levels follow the size
+    list = createList();
+    for (int i = 0; i < initialKeys; i++)
+        insert(list, 0, i, i);
+    printf("%d keys -> %d levels\n", initialKeys, atomic_load(&list->levelCap));
+    destroyList(list);
+    printf("%d threads inserting/deleting at once, result correct: %s\n", maxThreads,
+           concurrentCheck(maxThreads < 4 ? 4 : maxThreads, 200000) ? "yes" : "NO");
+    printf("  reclamation bounded: %s\n\n",
+           churnCheck(maxThreads < 4 ? 4 : maxThreads, 1000, 500000) ? "yes" : "NO");
+
+    printf("Throughput in million ops/s (%d keys, %.1f s per run, %ld core(s) online)\n",
+           initialKeys, seconds, cores);
+    printf("Mix (search/insert/delete) | Threads | Lock-free | One mutex\n");
+    printf("---------------------------+---------+-----------+----------\n");
+    int mixes[] = {90, 50};
+    for (int m = 0; m < 2; m++) {
+        for (int threads = 1; ; threads *= 2) {
+            if (threads > maxThreads) threads = maxThreads;
+            double lockFree = runMix(initialKeys, threads, mixes[m], seconds, 0);
+            double locked = runMix(initialKeys, threads, mixes[m], seconds, 1);
+            printf("%2d / %2d / %2d               | %7d | %9.2f | %8.2f\n",
+                   mixes[m], (100 - mixes[m]) / 2, (100 - mixes[m]) / 2,
+                   threads, lockFree, locked);
+            if (threads == maxThreads) break;
+        }
+    }
+    if (cores < 2)
+        printf("\nOnly one core online: threads take turns, expect no scaling.\n");
+    return 0;
+}
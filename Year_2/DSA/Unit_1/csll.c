@@ -1,89 +1,88 @@
+// Circular singly linked list on intrusive_list.c's CList: the list is
+// kept by its tail, so insert at the end and at the front are both O(1).
+// Nodes come from a NodePool and go back to it when deleted.
+//
+// Compile: gcc csll.c intrusive_list.c -o csll
+
 #include <stdio.h>
 #include <stdlib.h>
+#include "intrusive_list.h"
 
 struct Node {
     int data;
-    struct Node* next;
+    SLink link;
 };
 
-void insert_end(struct Node** tail, int val) {
-    struct Node* newnode = malloc(sizeof(struct Node));
-    newnode->data = val;
-    if (*tail == NULL) {
-        newnode->next = newnode;
-        *tail = newnode;
-    } else {
-        newnode->next = (*tail)->next;
-        (*tail)->next = newnode;
-        *tail = newnode;
+NodePool nodes;
+
+#define NODE(p) LIST_ENTRY(p, struct Node, link)
+
+struct Node* newNode(int val) {
+    struct Node* newnode = nodePoolGet(&nodes);
+    if (!newnode) {
+        printf("Out of memory\n");
+        exit(1);
     }
+    newnode->data = val;
+    return newnode;
 }
 
-void traverse(struct Node* tail) {
-    if(!tail) { printf("Empty\n"); return;}
-    struct Node *p = tail->next;
+void insert_end(CList* list, int val) {
+    clistPushBack(list, &newNode(val)->link);
+}
+
+void traverse(CList* list) {
+    if (!list->tail) { printf("Empty\n"); return; }
+    SLink* p = clistFirst(list);
     do {
-        printf("%d -> ", p->data);
+        printf("%d -> ", NODE(p)->data);
         p = p->next;
-    } while (p != tail->next);
+    } while (p != clistFirst(list));
     printf("\n");
 }
 
-void delete_node(struct Node** tail, int key) {
-    if (!*tail) return;
-    struct Node *curr = (*tail)->next, *prev = *tail;
+void delete_node(CList* list, int key) {
+    if (!list->tail) return;
+    SLink* prev = list->tail;
     do {
-        if (curr->data == key) {
-            if (curr == prev) { // only one node
-                free(curr);
-                *tail = NULL;
-            } else {
-                prev->next = curr->next;
-                if (curr == *tail) *tail = prev; // update tail if needed
-                free(curr);
-            }
+        if (NODE(prev->next)->data == key) {
+            nodePoolPut(&nodes, NODE(clistRemoveAfter(list, prev)));
             return;
         }
-        prev = curr;
-        curr = curr->next;
-    } while (curr != (*tail)->next);
+        prev = prev->next;
+    } while (prev != list->tail);
 }
 
-void insert_at_position(struct Node** tail, int val, int pos) {
+void insert_at_position(CList* list, int val, int pos) {
     if (pos < 1) {
         printf("Position should be >= 1\n");
         return;
     }
-    struct Node* newnode = malloc(sizeof(struct Node));
-    newnode->data = val;
-    if (*tail == NULL) {
-        if (pos != 1) {
-            printf("List is empty. Can only insert at position 1.\n");
-            free(newnode);
-            return;
-        }
-        newnode->next = newnode;
-        *tail = newnode;
-    } else if (pos == 1) {
-        newnode->next = (*tail)->next;
-        (*tail)->next = newnode;
-    } else {
-        struct Node* curr = (*tail)->next;
-        for (int i = 1; i < pos - 1; i++) {
-            curr = curr->next;
-            if (curr == (*tail)->next) {
-                printf("Position out of bounds. Inserting at end.\n");
-                break;
-            }
+    if (!list->tail && pos != 1) {
+        printf("List is empty. Can only insert at position 1.\n");
+        return;
+    }
+    if (pos == 1) {
+        clistPushFront(list, &newNode(val)->link);
+        return;
+    }
+    SLink* curr = clistFirst(list);
+    for (int i = 1; i < pos - 1; i++) {
+        curr = curr->next;
+        if (curr == clistFirst(list)) {
+            printf("Position out of bounds. Inserting at end.\n");
+            curr = list->tail;
+            break;
         }
-        newnode->next = curr->next;
-        curr->next = newnode;
-        if (curr == *tail) *tail = newnode; // update tail if inserted at end
     }
+    clistInsertAfter(list, curr, &newNode(val)->link);
 }
+
 int main() {
-    struct Node* tail = NULL;
+    CList list;
     int choice, val, key;
+    clistInit(&list);
+    nodePoolInit(&nodes, sizeof(struct Node));
     while (1) {
         printf("\n--- Circular Singly Linked List Operations ---\n");
         printf("1. Insert at end\n");
@@ -92,31 +91,33 @@ int main() {
         printf("4. Traverse\n");
         printf("5. Exit\n");
         printf("Enter your choice: ");
-        scanf("%d", &choice);
+        if (scanf("%d", &choice) != 1) break;
         switch (choice) {
             case 1:
                 printf("Enter value to insert: ");
                 scanf("%d", &val);
-                insert_end(&tail, val);
+                insert_end(&list, val);
                 break;
             case 2:
                 printf("Enter value and position to insert: ");
                 scanf("%d %d", &val, &key);
-                insert_at_position(&tail, val, key);
+                insert_at_position(&list, val, key);
                 break;
             case 3:
                 printf("Enter value to delete: ");
                 scanf("%d", &key);
-                delete_node(&tail, key);
+                delete_node(&list, key);
                 break;
             case 4:
-                traverse(tail);
+                traverse(&list);
                 break;
             case 5:
+                nodePoolDestroy(&nodes);
                 exit(0);
             default:
                 printf("Invalid choice. Please try again.\n");
         }
     }
+    nodePoolDestroy(&nodes);
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,126 @@
+#include <stdlib.h>
+#include <string.h>
+#include "dary_heap.h"
+
+// Element i's children are d*i+1 .. d*i+d, its parent is (i-1)/d.
+// Sifting moves a "hole" instead of swapping: the moving element waits
+// in scratch and is written once at the end (one copy per level, not three).
+
+#define AT(h, i) ((h)->data + (i) * (h)->elemSize)
+#define ABOVE(h, a, b) ((h)->sign * (h)->cmp((a), (b)) > 0)     // a belongs above b
+
+void heapInit(DaryHeap* h, size_t elemSize, int d, HeapCompare cmp) {
+    h->count = 0;
+    h->capacity = 16;
+    h->elemSize = elemSize;
+    h->d = d < 2 ? 2 : d;
+    h->cmp = cmp;
+    h->sign = 1;
+    h->data = malloc(h->capacity * elemSize);
+    h->scratch = malloc(elemSize);
+}
+
+void heapInitMin(DaryHeap* h, size_t elemSize, int d, HeapCompare cmp) {
+    heapInit(h, elemSize, d, cmp);
+    h->sign = -1;
+}
+
+void heapFree(DaryHeap* h) {
+    free(h->data);
+    free(h->scratch);
+    h->data = h->scratch = NULL;
+    h->count = h->capacity = 0;
+}
+
+size_t heapSize(const DaryHeap* h) {
+    return h->count;
+}
+
+static void grow(DaryHeap* h, size_t needed) {
+    if (needed <= h->capacity)
+        return;
+    while (h->capacity < needed)
+        h->capacity *= 2;
+    h->data = realloc(h->data, h->capacity * h->elemSize);
+}
+
+// Put scratch at hole i, moving parents down while scratch is bigger
+static void siftUp(DaryHeap* h, size_t i) {
+    while (i > 0) {
+        size_t parent = (i - 1) / h->d;
+        if (!ABOVE(h, h->scratch, AT(h, parent)))
+            break;
+        memcpy(AT(h, i), AT(h, parent), h->elemSize);
+        i = parent;
+    }
+    memcpy(AT(h, i), h->scratch, h->elemSize);
+}
+
+// Put scratch at hole i, moving the biggest child up while it beats scratch
+static void siftDown(DaryHeap* h, size_t i) {
+    size_t n = h->count;
+    while (1) {
+        size_t first = i * h->d + 1;
+        if (first >= n)
+            break;
+        size_t last = first + h->d < n ? first + h->d : n;
+        size_t best = first;
+        for (size_t c = first + 1; c < last; c++)
+            if (ABOVE(h, AT(h, c), AT(h, best)))
+                best = c;
+        if (!ABOVE(h, AT(h, best), h->scratch))
+            break;
+        memcpy(AT(h, i), AT(h, best), h->elemSize);
+        i = best;
+    }
+    memcpy(AT(h, i), h->scratch, h->elemSize);
+}
+
+void heapPush(DaryHeap* h, const void* elem) {
+    grow(h, h->count + 1);
+    memcpy(h->scratch, elem, h->elemSize);
+    siftUp(h, h->count++);
+}
+
+void* heapPeek(const DaryHeap* h) {
+    return h->count ? h->data : NULL;
+}
+
+int heapPop(DaryHeap* h, void* out) {
+    if (h->count == 0)
+        return 0;
+    if (out)
+        memcpy(out, h->data, h->elemSize);
+    h->count--;
+    if (h->count > 0) {
+        memcpy(h->scratch, AT(h, h->count), h->elemSize);
+        siftDown(h, 0);
+    }
+    return 1;
+}
+
+int heapReplaceTop(DaryHeap* h, const void* elem, void* out) {
+    if (h->count == 0) {
+        heapPush(h, elem);
+        return 0;
+    }
+    if (out)
+        memcpy(out, h->data, h->elemSize);
+    memcpy(h->scratch, elem, h->elemSize);
+    siftDown(h, 0);
+    return 1;
+}
+
+// Bottom-up: sift down every internal node, last one first.
+// Most nodes are near the bottom and move at most a level or two: O(n).
+void heapify(DaryHeap* h, const void* array, size_t n) {
+    grow(h, n);
+    memcpy(h->data, array, n * h->elemSize);
+    h->count = n;
+    if (n < 2)
+        return;
+    for (size_t i = (n - 2) / h->d + 1; i-- > 0; ) {
+        memcpy(h->scratch, AT(h, i), h->elemSize);
+        siftDown(h, i);
+    }
+}
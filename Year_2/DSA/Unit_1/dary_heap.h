@@ -0,0 +1,34 @@
+#ifndef DARY_HEAP_H
+#define DARY_HEAP_H
+
+#include <stddef.h>
+
+// Growable d-ary heap of any element type.
+// cmp works like qsort's: the element that compares LARGEST is on top
+// (heapInitMin puts the SMALLEST on top with the same cmp).
+// d = children per node, 2 = binary heap; 4 is usually fastest
+// (shallower tree, children share a cache line).
+typedef int (*HeapCompare)(const void* a, const void* b);
+
+typedef struct {
+    char* data;
+    size_t count;
+    size_t capacity;
+    size_t elemSize;
+    int d;
+    HeapCompare cmp;
+    int sign;               // +1 max-heap, -1 min-heap
+    char* scratch;          // one element of temp space for sifting
+} DaryHeap;
+
+void heapInit(DaryHeap* h, size_t elemSize, int d, HeapCompare cmp);
+void heapInitMin(DaryHeap* h, size_t elemSize, int d, HeapCompare cmp);
+void heapFree(DaryHeap* h);
+size_t heapSize(const DaryHeap* h);
+void heapPush(DaryHeap* h, const void* elem);           // O(log n)
+int heapPop(DaryHeap* h, void* out);                    // O(d log n), 0 if empty
+void* heapPeek(const DaryHeap* h);                      // NULL if empty
+void heapify(DaryHeap* h, const void* array, size_t n); // replaces contents, O(n)
+int heapReplaceTop(DaryHeap* h, const void* elem, void* out);   // pop + push, one sift
+
+#endif
@@ -0,0 +1,104 @@
+// Benchmark for dary_heap.c: push, pop, heapify and replace-top for
+// 1K .. 100M ints, with d = 2, 4 and 8, next to the sorted-array
+// (insertion shift) priority queue from Orange Problem Prep/queue.c.
+//
+// Compile: gcc -O2 dary_heap_bench.c dary_heap.c -o heapbench
+// Run:     ./heapbench [maxElements]        (100000000 needs ~1.5 GB)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "dary_heap.h"
+
+unsigned int seed = 2463534242u;
+
+unsigned int nextRandom() {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+int compareInt(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Old way: keep items sorted, shift to make room (O(n) per push)
+void sortedPush(int items[], int* size, int value) {
+    int i;
+    for (i = *size - 1; i >= 0 && items[i] > value; i--)
+        items[i + 1] = items[i];
+    items[i + 1] = value;
+    (*size)++;
+}
+
+int main(int argc, char* argv[]) {
+    long maxElements = argc > 1 ? atol(argv[1]) : 10000000;
+    int arities[] = { 2, 4, 8 };
+
+    printf("ns per element (push = n pushes, pop = pop all, replace = n replace-tops)\n");
+    printf("Elements  | d | push   | pop    | heapify | replace | sorted-array push | pops in order\n");
+    printf("----------+---+--------+--------+---------+---------+-------------------+--------------\n");
+
+    for (long n = 1000; n <= maxElements; n *= 10) {
+        int* values = malloc(n * sizeof(int));
+        for (long i = 0; i < n; i++) values[i] = (int)(nextRandom() >> 1);
+
+        // Sorted-array baseline is O(n^2): only run it while that is quick
+        double sortedNs = -1;
+        if (n <= 100000) {
+            int* items = malloc(n * sizeof(int));
+            int size = 0;
+            double t = nowSeconds();
+            for (long i = 0; i < n; i++) sortedPush(items, &size, values[i]);
+            sortedNs = (nowSeconds() - t) / n * 1e9;
+            free(items);
+        }
+
+        for (int a = 0; a < 3; a++) {
+            DaryHeap h;
+            heapInit(&h, sizeof(int), arities[a], compareInt);
+
+            double t = nowSeconds();
+            for (long i = 0; i < n; i++) heapPush(&h, &values[i]);
+            double push = nowSeconds() - t;
+
+            int ordered = 1, previous, top;
+            t = nowSeconds();
+            heapPop(&h, &previous);
+            while (heapPop(&h, &top)) {
+                if (top > previous) ordered = 0;
+                previous = top;
+            }
+            double pop = nowSeconds() - t;
+
+            t = nowSeconds();
+            heapify(&h, values, n);
+            double build = nowSeconds() - t;
+
+            t = nowSeconds();
+            for (long i = 0; i < n; i++) {
+                int v = (int)(nextRandom() >> 1);
+                heapReplaceTop(&h, &v, NULL);
+            }
+            double replace = nowSeconds() - t;
+
+            printf("%9ld | %d | %6.1f | %6.1f | %7.1f | %7.1f | ", n, arities[a],
+                   push / n * 1e9, pop / n * 1e9, build / n * 1e9, replace / n * 1e9);
+            if (a == 0 && sortedNs >= 0) printf("%17.1f | ", sortedNs);
+            else printf("%17s | ", a == 0 ? "(skipped)" : "");
+            printf("%s\n", ordered ? "yes" : "NO");
+            heapFree(&h);
+        }
+        free(values);
+        if (n < maxElements && n * 10 > maxElements) n = maxElements / 10;  // end exactly at max
+    }
+    return 0;
+}
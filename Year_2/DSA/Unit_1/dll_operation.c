@@ -1,59 +1,66 @@
+// Doubly linked list on intrusive_list.c's DList: the node holds a
+// DLink, nodes come from a NodePool, and insert_end is O(1) because the
+// sentinel's prev is always the last node.
+//
+// Compile: gcc dll_operation.c intrusive_list.c -o dll
+
 #include <stdio.h>
 #include <stdlib.h>
+#include "intrusive_list.h"
 
 struct Node {
     int data;
-    struct Node *prev, *next;
+    DLink link;
 };
 
-void insert_front(struct Node** head, int val) {
-    struct Node* newnode = malloc(sizeof(struct Node));
+NodePool nodes;
+
+#define NODE(p) LIST_ENTRY(p, struct Node, link)
+
+struct Node* newNode(int val) {
+    struct Node* newnode = nodePoolGet(&nodes);
+    if (!newnode) {
+        printf("Out of memory\n");
+        exit(1);
+    }
     newnode->data = val;
-    newnode->prev = NULL; 
-    newnode->next = *head;
-    if (*head) (*head)->prev = newnode;
-    *head = newnode;
+    return newnode;
 }
 
-void insert_end(struct Node** head, int val) {
-    struct Node* newnode = malloc(sizeof(struct Node));
-    newnode->data = val; 
-    newnode->next = NULL;
-    if(!*head) { 
-        newnode->prev = NULL; 
-        *head = newnode; 
-        return; }
-    struct Node* temp = *head;
-    while(temp->next) temp = temp->next;
-    temp->next = newnode; 
-    newnode->prev = temp;
+void insert_front(DList* list, int val) {
+    dlistPushFront(list, &newNode(val)->link);
 }
 
-void delete_value(struct Node** head, int val) {
-    struct Node* temp = *head;
-    while(temp && temp->data != val) temp = temp->next;
-    if(!temp) return;
-    if(temp->prev) temp->prev->next = temp->next;
-    else *head = temp->next;
-    if(temp->next) temp->next->prev = temp->prev;
-    free(temp);
+void insert_end(DList* list, int val) {
+    dlistPushBack(list, &newNode(val)->link);
 }
 
-void traverse(struct Node* head) {
-    while (head) {
-        printf("%d <-> ", head->data);
-        head = head->next;
+void delete_value(DList* list, int val) {
+    for (DLink* p = DLIST_FIRST(list); p != DLIST_END(list); p = p->next) {
+        if (NODE(p)->data == val) {
+            dlistRemove(list, p);
+            nodePoolPut(&nodes, NODE(p));
+            return;
+        }
     }
+}
+
+void traverse(DList* list) {
+    for (DLink* p = DLIST_FIRST(list); p != DLIST_END(list); p = p->next)
+        printf("%d <-> ", NODE(p)->data);
     printf("NULL\n");
 }
 
 int main() {
-    struct Node* head = NULL;
-    insert_front(&head, 1);
-    insert_end(&head, 2);
-    insert_end(&head, 3);
-    traverse(head);
-    delete_value(&head, 2);
-    traverse(head);
+    DList list;
+    dlistInit(&list);
+    nodePoolInit(&nodes, sizeof(struct Node));
+    insert_front(&list, 1);
+    insert_end(&list, 2);
+    insert_end(&list, 3);
+    traverse(&list);
+    delete_value(&list, 2);
+    traverse(&list);
+    nodePoolDestroy(&nodes);
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,367 @@
+// Implicit-key treap: a sequence (like a linked list) where
+// insert_at, delete_at, split, concat and reverse_range are all O(log n).
+//
+// Each node stores the SIZE of its subtree instead of a key.
+// Position of a node = size of everything to its left, so "go to index k"
+// is a walk down the tree, not along a list.
+// Random priorities keep the tree balanced (heap order on priority).
+// reverse_range only flips a "rev" flag; it is pushed down lazily.
+//
+// Compile: gcc -O2 implicit_treap.c -o treap
+// Run:     ./treap [sequenceLength] [listOps]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+struct TNode {
+    int data;
+    unsigned int priority;
+    int size;
+    int rev;
+    struct TNode *left, *right;
+};
+
+unsigned int seed = 2463534242u;
+
+unsigned int next_random() {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+struct TNode* create_tnode(int val) {
+    struct TNode* node = malloc(sizeof(struct TNode));
+    node->data = val;
+    node->priority = next_random();
+    node->size = 1;
+    node->rev = 0;
+    node->left = node->right = NULL;
+    return node;
+}
+
+int size_of(struct TNode* t) {
+    return t ? t->size : 0;
+}
+
+void update(struct TNode* t) {
+    t->size = 1 + size_of(t->left) + size_of(t->right);
+}
+
+// Apply a pending reversal: swap children, pass the flag down
+void push_down(struct TNode* t) {
+    if (!t || !t->rev) return;
+    struct TNode* temp = t->left;
+    t->left = t->right;
+    t->right = temp;
+    if (t->left) t->left->rev ^= 1;
+    if (t->right) t->right->rev ^= 1;
+    t->rev = 0;
+}
+
+// Split t into the first k elements (*l) and the rest (*r)
+void split(struct TNode* t, int k, struct TNode** l, struct TNode** r) {
+    if (!t) { *l = *r = NULL; return; }
+    push_down(t);
+    if (size_of(t->left) < k) {
+        split(t->right, k - size_of(t->left) - 1, &t->right, r);
+        *l = t;
+    } else {
+        split(t->left, k, l, &t->left);
+        *r = t;
+    }
+    update(t);
+}
+
+// Concatenate: every element of a comes before every element of b
+struct TNode* concat(struct TNode* a, struct TNode* b) {
+    if (!a) return b;
+    if (!b) return a;
+    if (a->priority > b->priority) {
+        push_down(a);
+        a->right = concat(a->right, b);
+        update(a);
+        return a;
+    }
+    push_down(b);
+    b->left = concat(a, b->left);
+    update(b);
+    return b;
+}
+
+// Insert val so that it ends up at index pos (0 = front)
+void insert_at(struct TNode** root, int val, int pos) {
+    if (pos < 0 || pos > size_of(*root)) return; // position out of range
+    struct TNode *l, *r;
+    split(*root, pos, &l, &r);
+    *root = concat(concat(l, create_tnode(val)), r);
+}
+
+// Delete the element at index pos, returns its value (-1 if out of range)
+int delete_at(struct TNode** root, int pos) {
+    if (pos < 0 || pos >= size_of(*root)) return -1;
+    struct TNode *l, *mid, *r;
+    split(*root, pos, &l, &r);
+    split(r, 1, &mid, &r);
+    int val = mid->data;
+    free(mid);
+    *root = concat(l, r);
+    return val;
+}
+
+int get_at(struct TNode* root, int pos) {
+    while (root) {
+        push_down(root);
+        int leftSize = size_of(root->left);
+        if (pos < leftSize) root = root->left;
+        else if (pos == leftSize) return root->data;
+        else { pos -= leftSize + 1; root = root->right; }
+    }
+    return -1;
+}
+
+// Reverse the elements at indexes from..to (inclusive)
+void reverse_range(struct TNode** root, int from, int to) {
+    if (from < 0 || to >= size_of(*root) || from >= to) return;
+    struct TNode *l, *mid, *r;
+    split(*root, from, &l, &mid);
+    split(mid, to - from + 1, &mid, &r);
+    mid->rev ^= 1;
+    *root = concat(concat(l, mid), r);
+}
+
+// Copy the sequence into out[] (inorder)
+int to_array(struct TNode* t, int out[], int idx) {
+    if (!t) return idx;
+    push_down(t);
+    idx = to_array(t->left, out, idx);
+    out[idx++] = t->data;
+    return to_array(t->right, out, idx);
+}
+
+void traverse(struct TNode* root) {
+    int n = size_of(root);
+    int* values = malloc(n * sizeof(int));
+    to_array(root, values, 0);
+    for (int i = 0; i < n; i++) printf("%d -> ", values[i]);
+    printf("NULL\n");
+    free(values);
+}
+
+void free_treap(struct TNode* t) {
+    if (!t) return;
+    free_treap(t->left);
+    free_treap(t->right);
+    free(t);
+}
+
+// Baseline: singly linked list with insert_at from sll_insertion.c
+struct Node {
+    int data;
+    struct Node* next;
+};
+
+void list_insert_at(struct Node** head, int val, int pos) {
+    struct Node* newnode = malloc(sizeof(struct Node));
+    newnode->data = val;
+    if (pos == 0) {
+        newnode->next = *head;
+        *head = newnode;
+        return;
+    }
+    struct Node* temp = *head;
+    for (int i = 0; i < pos-1 && temp; i++)
+        temp = temp->next;
+    if (temp == NULL) { free(newnode); return; }
+    newnode->next = temp->next;
+    temp->next = newnode;
+}
+
+int list_delete_at(struct Node** head, int pos) {
+    struct Node* temp = *head;
+    if (!temp) return -1;
+    if (pos == 0) {
+        *head = temp->next;
+        int val = temp->data;
+        free(temp);
+        return val;
+    }
+    for (int i = 0; i < pos-1 && temp->next; i++)
+        temp = temp->next;
+    struct Node* del = temp->next;
+    if (!del) return -1;
+    temp->next = del->next;
+    int val = del->data;
+    free(del);
+    return val;
+}
+
+// Baseline: doubly linked list, walks from whichever end is nearer
+struct DNode {
+    int data;
+    struct DNode *prev, *next;
+};
+
+struct DList {
+    struct DNode *head, *tail;
+    int size;
+};
+
+struct DNode* dlist_node_at(struct DList* list, int pos) {
+    struct DNode* temp;
+    if (pos < list->size / 2) {
+        temp = list->head;
+        for (int i = 0; i < pos; i++) temp = temp->next;
+    } else {
+        temp = list->tail;
+        for (int i = list->size - 1; i > pos; i--) temp = temp->prev;
+    }
+    return temp;
+}
+
+void dlist_insert_at(struct DList* list, int val, int pos) {
+    struct DNode* newnode = malloc(sizeof(struct DNode));
+    newnode->data = val;
+    struct DNode* after = (pos < list->size) ? dlist_node_at(list, pos) : NULL;
+    struct DNode* before = after ? after->prev : list->tail;
+    newnode->prev = before;
+    newnode->next = after;
+    if (before) before->next = newnode; else list->head = newnode;
+    if (after) after->prev = newnode; else list->tail = newnode;
+    list->size++;
+}
+
+int dlist_delete_at(struct DList* list, int pos) {
+    struct DNode* temp = dlist_node_at(list, pos);
+    if (temp->prev) temp->prev->next = temp->next; else list->head = temp->next;
+    if (temp->next) temp->next->prev = temp->prev; else list->tail = temp->prev;
+    int val = temp->data;
+    free(temp);
+    list->size--;
+    return val;
+}
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Same random edits on the treap and on the singly list, then compare
+int check_against_list(int n, int ops) {
+    struct TNode* root = NULL;
+    struct Node* head = NULL;
+    for (int i = 0; i < n; i++) {
+        insert_at(&root, i, i);
+        list_insert_at(&head, i, 0);  // build reversed list ...
+    }
+    reverse_range(&root, 0, n - 1);   // ... and reverse the treap to match
+    for (int i = 0; i < ops; i++) {
+        int size = size_of(root);
+        if (next_random() % 2 || size == 0) {
+            int pos = next_random() % (size + 1);
+            insert_at(&root, -i, pos);
+            list_insert_at(&head, -i, pos);
+        } else {
+            int pos = next_random() % size;
+            if (delete_at(&root, pos) != list_delete_at(&head, pos)) return 0;
+        }
+    }
+    int ok = 1, pos = 0;
+    for (struct Node* temp = head; temp; temp = temp->next, pos++)
+        if (get_at(root, pos) != temp->data) ok = 0;
+    if (pos != size_of(root)) ok = 0;
+    while (head) { struct Node* next = head->next; free(head); head = next; }
+    free_treap(root);
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int listOps = argc > 2 ? atoi(argv[2]) : 2000;
+    int treapOps = 1000000;
+
+    // Demo
+    struct TNode* root = NULL;
+    for (int i = 0; i < 8; i++) insert_at(&root, (i + 1) * 10, i);
+    traverse(root);
+    insert_at(&root, 15, 1);
+    printf("insert_at(15, 1):      "); traverse(root);
+    delete_at(&root, 3);
+    printf("delete_at(3):          "); traverse(root);
+    reverse_range(&root, 2, 6);
+    printf("reverse_range(2, 6):   "); traverse(root);
+    struct TNode *l, *r;
+    split(root, 4, &l, &r);
+    printf("split at 4, left:      "); traverse(l);
+    printf("split at 4, right:     "); traverse(r);
+    root = concat(r, l);
+    printf("concat(right, left):   "); traverse(root);
+    free_treap(root);
+
+    printf("\nRandom edits match the linked list: %s\n\n",
+           check_against_list(2000, 5000) ? "yes" : "NO");
+
+    // Benchmark on an n-element sequence
+    double t = now_seconds();
+    root = NULL;
+    for (int i = 0; i < n; i++) root = concat(root, create_tnode(i));
+    double treapBuild = now_seconds() - t;
+
+    t = now_seconds();
+    struct Node* head = NULL;
+    struct Node* tail = NULL;
+    for (int i = 0; i < n; i++) {
+        struct Node* newnode = malloc(sizeof(struct Node));
+        newnode->data = i; newnode->next = NULL;
+        if (tail) tail->next = newnode; else head = newnode;
+        tail = newnode;
+    }
+    double listBuild = now_seconds() - t;
+
+    struct DList dlist = { NULL, NULL, 0 };
+    for (int i = 0; i < n; i++) dlist_insert_at(&dlist, i, i);
+
+    printf("Sequence of %d elements (build: treap %.1f ms, list %.1f ms)\n",
+           n, treapBuild * 1e3, listBuild * 1e3);
+    printf("Operation (random position) | Ops     | ns per op\n");
+    printf("----------------------------+---------+-----------\n");
+
+    t = now_seconds();
+    for (int i = 0; i < treapOps; i++) {
+        insert_at(&root, i, next_random() % (size_of(root) + 1));
+        delete_at(&root, next_random() % size_of(root));
+    }
+    printf("treap insert_at + delete_at | %7d | %9.0f\n", treapOps,
+           (now_seconds() - t) / treapOps * 1e9);
+
+    t = now_seconds();
+    for (int i = 0; i < treapOps; i++) {
+        int a = next_random() % n, b = next_random() % n;
+        reverse_range(&root, a < b ? a : b, a < b ? b : a);
+    }
+    printf("treap reverse_range         | %7d | %9.0f\n", treapOps,
+           (now_seconds() - t) / treapOps * 1e9);
+
+    t = now_seconds();
+    for (int i = 0; i < listOps; i++) {
+        list_insert_at(&head, i, next_random() % (n + 1));
+        list_delete_at(&head, next_random() % n);
+    }
+    printf("sll insert_at + delete_at   | %7d | %9.0f\n", listOps,
+           (now_seconds() - t) / listOps * 1e9);
+
+    t = now_seconds();
+    for (int i = 0; i < listOps; i++) {
+        dlist_insert_at(&dlist, i, next_random() % (dlist.size + 1));
+        dlist_delete_at(&dlist, next_random() % dlist.size);
+    }
+    printf("dll insert_at + delete_at   | %7d | %9.0f\n", listOps,
+           (now_seconds() - t) / listOps * 1e9);
+
+    free_treap(root);
+    while (head) { struct Node* next = head->next; free(head); head = next; }
+    while (dlist.head) { struct DNode* next = dlist.head->next; free(dlist.head); dlist.head = next; }
+    return 0;
+}
@@ -0,0 +1,388 @@
+// Indexable skip list (sorted set / leaderboard)
+//
+// Same skip list as skiplist_operations.c, plus a SPAN on every link:
+//   span = how many level-0 steps this link jumps over
+// Adding up spans while searching gives the RANK of a node, and following
+// spans lets us jump straight to "the node at rank r".
+//
+// Elements are (score, member) pairs ordered by score, then member,
+// like a Redis sorted set. Operations:
+//   insertMember / deleteMember      O(log n)
+//   getByRank(r)                     O(log n)   r-th element (1 = lowest)
+//   getRank(score, member)           O(log n)
+//   deleteRangeByScore(min, max)     O(log n) to unlink the whole range
+//                                    (+ O(k) to free the k removed nodes)
+//
+// Compile: gcc -O2 indexable_skiplist.c ../common/skiplist_common.c -o ranks
+// Run:     ./ranks [members] [operations]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../common/skiplist_common.h"
+
+#define MAXLVL 32
+
+typedef struct snode {
+    double score;
+    int member;
+    int height;                 // Entries in level[], for the pool size class
+    struct slevel {
+        struct snode *forward;
+        long span;              // Level-0 steps from this node to forward
+    } level[];
+} snode;
+
+typedef struct skiplist {
+    snode *header;
+    int level;                  // Levels in use
+    long length;
+    SkipNodePool pool;          // Every node, one size class per height
+} skiplist;
+
+// Levels 1 .. MAXLVL, P = 0.25 like Redis (skipRandomLevel in skiplist_common.c)
+int randomLevel() {
+    return 1 + skipRandomLevel(MAXLVL - 1, 2);
+}
+
+snode* createNode(skiplist* list, int level, double score, int member) {
+    snode* n = skipPoolAlloc(&list->pool, level - 1);
+    n->score = score;
+    n->member = member;
+    n->height = level;
+    for (int i = 0; i < level; i++) {
+        n->level[i].forward = NULL;
+        n->level[i].span = 0;
+    }
+    return n;
+}
+
+skiplist* createList() {
+    skiplist* list = malloc(sizeof(skiplist));
+    skipPoolInit(&list->pool, sizeof(snode), sizeof(struct slevel));
+    list->header = createNode(list, MAXLVL, 0, -1);
+    list->level = 1;
+    list->length = 0;
+    return list;
+}
+
+void freeList(skiplist* list) {
+    skipPoolDestroy(&list->pool);
+    free(list);
+}
+
+// (score, member) ordering
+int before(snode* x, double score, int member) {
+    return x->score < score || (x->score == score && x->member < member);
+}
+
+void insertMember(skiplist* list, double score, int member) {
+    snode *update[MAXLVL];
+    long rank[MAXLVL];          // rank[i] = rank of update[i]
+    snode *x = list->header;
+
+    for (int i = list->level - 1; i >= 0; i--) {
+        rank[i] = (i == list->level - 1) ? 0 : rank[i + 1];
+        while (x->level[i].forward && before(x->level[i].forward, score, member)) {
+            rank[i] += x->level[i].span;
+            x = x->level[i].forward;
+        }
+        update[i] = x;
+    }
+
+    int lvl = randomLevel();
+    if (lvl > list->level) {
+        for (int i = list->level; i < lvl; i++) {
+            rank[i] = 0;
+            update[i] = list->header;
+            update[i]->level[i].span = list->length;
+        }
+        list->level = lvl;
+    }
+
+    x = createNode(list, lvl, score, member);
+    for (int i = 0; i < lvl; i++) {
+        x->level[i].forward = update[i]->level[i].forward;
+        update[i]->level[i].forward = x;
+        // x sits (rank[0] - rank[i]) steps after update[i]
+        x->level[i].span = update[i]->level[i].span - (rank[0] - rank[i]);
+        update[i]->level[i].span = (rank[0] - rank[i]) + 1;
+    }
+    // Links above x now jump over one more node
+    for (int i = lvl; i < list->level; i++)
+        update[i]->level[i].span++;
+    list->length++;
+}
+
+// Returns 1 if (score, member) was found and deleted
+int deleteMember(skiplist* list, double score, int member) {
+    snode *update[MAXLVL];
+    snode *x = list->header;
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (x->level[i].forward && before(x->level[i].forward, score, member))
+            x = x->level[i].forward;
+        update[i] = x;
+    }
+    x = x->level[0].forward;
+    if (!x || x->score != score || x->member != member)
+        return 0;
+
+    for (int i = 0; i < list->level; i++) {
+        if (update[i]->level[i].forward == x) {
+            update[i]->level[i].span += x->level[i].span - 1;
+            update[i]->level[i].forward = x->level[i].forward;
+        } else {
+            update[i]->level[i].span--;
+        }
+    }
+    while (list->level > 1 && list->header->level[list->level - 1].forward == NULL)
+        list->level--;
+    list->length--;
+    skipPoolFree(&list->pool, x, x->height - 1);
+    return 1;
+}
+
+// Node at rank r (1 = lowest score), NULL if out of range
+snode* getByRank(skiplist* list, long r) {
+    snode *x = list->header;
+    long traversed = 0;
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (x->level[i].forward && traversed + x->level[i].span <= r) {
+            traversed += x->level[i].span;
+            x = x->level[i].forward;
+        }
+        if (traversed == r)
+            return x == list->header ? NULL : x;
+    }
+    return NULL;
+}
+
+// Rank of (score, member), 0 if not present
+long getRank(skiplist* list, double score, int member) {
+    snode *x = list->header;
+    long rank = 0;
+    for (int i = list->level - 1; i >= 0; i--) {
+        // Move while forward <= (score, member)
+        while (x->level[i].forward &&
+               (before(x->level[i].forward, score, member) ||
+                (x->level[i].forward->score == score && x->level[i].forward->member == member))) {
+            rank += x->level[i].span;
+            x = x->level[i].forward;
+        }
+        if (x != list->header && x->score == score && x->member == member)
+            return rank;
+    }
+    return 0;
+}
+
+// Remove every element with min <= score <= max.
+// removed[] (may be NULL) receives the removed members.
+//
+// Find on every level the last node BEFORE the range (a[i]) and the last
+// node INSIDE the range (b[i]), with their ranks. Then each level is
+// fixed with one pointer + one span change: link a[i] to what came after
+// b[i]. That is O(log n); only freeing the k nodes costs O(k).
+long deleteRangeByScore(skiplist* list, double min, double max, int removed[]) {
+    snode *a[MAXLVL] = { 0 }, *b[MAXLVL] = { 0 };
+    long rankA[MAXLVL] = { 0 }, rankB[MAXLVL] = { 0 };
+
+    snode *x = list->header;
+    long rank = 0;
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (x->level[i].forward && x->level[i].forward->score < min) {
+            rank += x->level[i].span;
+            x = x->level[i].forward;
+        }
+        a[i] = x;
+        rankA[i] = rank;
+    }
+    // b search can start where a ended on each level
+    x = list->header;
+    rank = 0;
+    for (int i = list->level - 1; i >= 0; i--) {
+        if (rankA[i] > rank) { x = a[i]; rank = rankA[i]; }
+        while (x->level[i].forward && x->level[i].forward->score <= max) {
+            rank += x->level[i].span;
+            x = x->level[i].forward;
+        }
+        b[i] = x;
+        rankB[i] = rank;
+    }
+
+    long k = rankB[0] - rankA[0];
+    if (k <= 0)
+        return 0;
+
+    snode *first = a[0]->level[0].forward;
+    for (int i = 0; i < list->level; i++) {
+        if (b[i] == a[i]) {
+            a[i]->level[i].span -= k;                    // Link jumps over the range
+        } else {
+            a[i]->level[i].span = rankB[i] + b[i]->level[i].span - k - rankA[i];
+            a[i]->level[i].forward = b[i]->level[i].forward;
+        }
+    }
+    while (list->level > 1 && list->header->level[list->level - 1].forward == NULL)
+        list->level--;
+    list->length -= k;
+
+    for (long j = 0; j < k; j++) {
+        snode *next = first->level[0].forward;
+        if (removed) removed[j] = first->member;
+        skipPoolFree(&list->pool, first, first->height - 1);
+        first = next;
+    }
+    return k;
+}
+
+// O(n) versions for checking and comparison
+long scanRank(skiplist* list, double score, int member) {
+    long rank = 0;
+    for (snode* x = list->header->level[0].forward; x; x = x->level[0].forward) {
+        rank++;
+        if (x->score == score && x->member == member) return rank;
+    }
+    return 0;
+}
+
+snode* scanByRank(skiplist* list, long r) {
+    snode* x = list->header;
+    for (long i = 0; i < r && x; i++) x = x->level[0].forward;
+    return x;
+}
+
+void printList(skiplist* list) {
+    for (snode* x = list->header->level[0].forward; x; x = x->level[0].forward)
+        printf("(%g, m%d) ", x->score, x->member);
+    printf("\n");
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+unsigned int seed = 12345u;
+unsigned int nextRandom() {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+// Every span must add up: walking each level must count exactly length
+int checkSpans(skiplist* list) {
+    for (int i = 0; i < list->level; i++) {
+        long steps = 0;
+        snode* x = list->header;
+        while (x->level[i].forward) {
+            steps += x->level[i].span;
+            x = x->level[i].forward;
+            if (scanRank(list, x->score, x->member) != steps) return 0;
+        }
+    }
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    int members = argc > 1 ? atoi(argv[1]) : 2000000;
+    int operations = argc > 2 ? atoi(argv[2]) : 1000000;
+
+    // Demo
+    skiplist* list = createList();
+    double demoScores[] = {50, 20, 80, 20, 65, 90, 35};
+    for (int m = 0; m < 7; m++)
+        insertMember(list, demoScores[m], m);
+    printf("Board: "); printList(list);
+    printf("Rank of (65, m4): %ld\n", getRank(list, 65, 4));
+    snode* third = getByRank(list, 3);
+    printf("Rank 3: (%g, m%d)\n", third->score, third->member);
+    long gone = deleteRangeByScore(list, 30, 70, NULL);
+    printf("deleteRangeByScore(30, 70) removed %ld: ", gone); printList(list);
+    printf("Rank of (90, m5) now: %ld\n", getRank(list, 90, 5));
+    freeList(list);
+
+    // Random check against the O(n) scans
+    list = createList();
+    int ok = 1;
+    for (int i = 0; i < 3000; i++)
+        insertMember(list, nextRandom() % 1000, i);
+    for (int i = 0; i < 300 && ok; i++) {
+        if (nextRandom() % 2) {
+            double lo = nextRandom() % 1000;
+            deleteRangeByScore(list, lo, lo + nextRandom() % 5, NULL);
+        } else {
+            insertMember(list, nextRandom() % 1000, 3000 + i);
+        }
+        long r = 1 + nextRandom() % list->length;
+        snode* x = getByRank(list, r);
+        if (x != scanByRank(list, r) || getRank(list, x->score, x->member) != r) ok = 0;
+    }
+    printf("\nRandom inserts/range deletes match O(n) scans: %s\n", ok && checkSpans(list) ? "yes" : "NO");
+    freeList(list);
+
+    // Leaderboard benchmark
+    double* scoreOf = malloc(members * sizeof(double));
+    list = createList();
+    double t = nowSeconds();
+    for (int m = 0; m < members; m++) {
+        scoreOf[m] = nextRandom() % 100000000;
+        insertMember(list, scoreOf[m], m);
+    }
+    printf("\nLeaderboard with %d members (built in %.2f s, %d levels)\n",
+           members, nowSeconds() - t, list->level);
+    printf("Operation                   | Ops      | ns per op\n");
+    printf("----------------------------+----------+----------\n");
+
+    t = nowSeconds();
+    long sum = 0;
+    for (int i = 0; i < operations; i++) {
+        int m = nextRandom() % members;
+        sum += getRank(list, scoreOf[m], m);
+    }
+    printf("rank of member              | %8d | %8.0f\n", operations, (nowSeconds() - t) / operations * 1e9);
+
+    t = nowSeconds();
+    for (int i = 0; i < operations; i++)
+        sum += getByRank(list, 1 + nextRandom() % list->length)->member;
+    printf("member at rank              | %8d | %8.0f\n", operations, (nowSeconds() - t) / operations * 1e9);
+
+    t = nowSeconds();
+    for (int i = 0; i < operations; i++) {
+        int m = nextRandom() % members;
+        if (scoreOf[m] < 0) continue;               // Removed by a range delete
+        deleteMember(list, scoreOf[m], m);
+        scoreOf[m] = nextRandom() % 100000000;
+        insertMember(list, scoreOf[m], m);
+    }
+    printf("score update (delete+insert)| %8d | %8.0f\n", operations, (nowSeconds() - t) / operations * 1e9);
+
+    // Cut a band of ~100 members out of the board, many times
+    int rangeOps = operations / 100;
+    int* removed = malloc(members * sizeof(int));
+    long removedTotal = 0;
+    t = nowSeconds();
+    for (int i = 0; i < rangeOps; i++) {
+        double lo = nextRandom() % 100000000;
+        long k = deleteRangeByScore(list, lo, lo + 4000, removed);
+        for (long j = 0; j < k; j++) scoreOf[removed[j]] = -1;
+        removedTotal += k;
+    }
+    printf("deleteRangeByScore ~%-4ld ea | %8d | %8.0f\n",
+           rangeOps ? removedTotal / rangeOps : 0, rangeOps, (nowSeconds() - t) / (rangeOps ? rangeOps : 1) * 1e9);
+
+    int scans = 20;
+    t = nowSeconds();
+    for (int i = 0; i < scans; i++) {
+        int m = nextRandom() % members;
+        if (scoreOf[m] >= 0) sum += scanRank(list, scoreOf[m], m);
+    }
+    printf("rank by O(n) scan           | %8d | %8.0f\n", scans, (nowSeconds() - t) / scans * 1e9);
+
+    printf("(checksum %ld, %ld members left)\n", sum, list->length);
+    freeList(list);
+    free(scoreOf);
+    free(removed);
+    return 0;
+}
@@ -0,0 +1,283 @@
+#include <stdlib.h>
+#include "intrusive_list.h"
+
+// ---------------- Singly linked ----------------
+
+void slistInit(SList* l) {
+    l->head = l->tail = NULL;
+    l->count = 0;
+}
+
+void slistPushFront(SList* l, SLink* link) {
+    link->next = l->head;
+    l->head = link;
+    if (!l->tail)
+        l->tail = link;
+    l->count++;
+}
+
+void slistPushBack(SList* l, SLink* link) {
+    link->next = NULL;
+    if (l->tail)
+        l->tail->next = link;
+    else
+        l->head = link;
+    l->tail = link;
+    l->count++;
+}
+
+SLink* slistPopFront(SList* l) {
+    return slistRemoveAfter(l, NULL);
+}
+
+void slistInsertAfter(SList* l, SLink* pos, SLink* link) {
+    if (!pos) {
+        slistPushFront(l, link);
+        return;
+    }
+    link->next = pos->next;
+    pos->next = link;
+    if (l->tail == pos)
+        l->tail = link;
+    l->count++;
+}
+
+SLink* slistRemoveAfter(SList* l, SLink* pos) {
+    SLink* victim = pos ? pos->next : l->head;
+    if (!victim)
+        return NULL;
+    if (pos)
+        pos->next = victim->next;
+    else
+        l->head = victim->next;
+    if (l->tail == victim)
+        l->tail = pos;
+    l->count--;
+    return victim;
+}
+
+void slistSplice(SList* dst, SList* src) {
+    if (!src->head)
+        return;
+    if (dst->tail)
+        dst->tail->next = src->head;
+    else
+        dst->head = src->head;
+    dst->tail = src->tail;
+    dst->count += src->count;
+    slistInit(src);
+}
+
+// ---------------- Doubly linked ----------------
+// The sentinel means there is no NULL to check for: an empty list is
+// the sentinel pointing at itself, and inserting or removing is always
+// the same four pointer writes.
+
+void dlistInit(DList* l) {
+    l->head.next = l->head.prev = &l->head;
+    l->count = 0;
+}
+
+DLink* dlistFirst(const DList* l) {
+    return l->count ? l->head.next : NULL;
+}
+
+DLink* dlistLast(const DList* l) {
+    return l->count ? l->head.prev : NULL;
+}
+
+void dlistInsertAfter(DList* l, DLink* pos, DLink* link) {
+    link->prev = pos;
+    link->next = pos->next;
+    pos->next->prev = link;
+    pos->next = link;
+    l->count++;
+}
+
+void dlistInsertBefore(DList* l, DLink* pos, DLink* link) {
+    dlistInsertAfter(l, pos->prev, link);
+}
+
+void dlistPushFront(DList* l, DLink* link) {
+    dlistInsertAfter(l, &l->head, link);
+}
+
+void dlistPushBack(DList* l, DLink* link) {
+    dlistInsertAfter(l, l->head.prev, link);
+}
+
+void dlistRemove(DList* l, DLink* link) {
+    link->prev->next = link->next;
+    link->next->prev = link->prev;
+    link->next = link->prev = NULL;
+    l->count--;
+}
+
+DLink* dlistPopFront(DList* l) {
+    DLink* link = dlistFirst(l);
+    if (link)
+        dlistRemove(l, link);
+    return link;
+}
+
+DLink* dlistPopBack(DList* l) {
+    DLink* link = dlistLast(l);
+    if (link)
+        dlistRemove(l, link);
+    return link;
+}
+
+void dlistSplice(DList* dst, DList* src) {
+    if (!src->count)
+        return;
+    DLink* first = src->head.next;
+    DLink* last = src->head.prev;
+    first->prev = dst->head.prev;
+    dst->head.prev->next = first;
+    last->next = &dst->head;
+    dst->head.prev = last;
+    dst->count += src->count;
+    dlistInit(src);
+}
+
+// ---------------- Circular singly linked ----------------
+
+void clistInit(CList* l) {
+    l->tail = NULL;
+    l->count = 0;
+}
+
+SLink* clistFirst(const CList* l) {
+    return l->tail ? l->tail->next : NULL;
+}
+
+void clistPushFront(CList* l, SLink* link) {
+    if (l->tail) {
+        link->next = l->tail->next;
+        l->tail->next = link;
+    } else {
+        link->next = link;
+        l->tail = link;
+    }
+    l->count++;
+}
+
+void clistPushBack(CList* l, SLink* link) {
+    clistPushFront(l, link);
+    l->tail = link;
+}
+
+void clistInsertAfter(CList* l, SLink* pos, SLink* link) {
+    link->next = pos->next;
+    pos->next = link;
+    if (pos == l->tail)
+        l->tail = link;
+    l->count++;
+}
+
+SLink* clistRemoveAfter(CList* l, SLink* pos) {
+    SLink* victim = pos->next;
+    if (victim == pos) {
+        l->tail = NULL;         // was the only one
+    } else {
+        pos->next = victim->next;
+        if (victim == l->tail)
+            l->tail = pos;
+    }
+    l->count--;
+    return victim;
+}
+
+SLink* clistPopFront(CList* l) {
+    return l->tail ? clistRemoveAfter(l, l->tail) : NULL;
+}
+
+void clistRotate(CList* l) {
+    if (l->tail)
+        l->tail = l->tail->next;
+}
+
+void clistSplice(CList* dst, CList* src) {
+    if (!src->tail)
+        return;
+    if (dst->tail) {
+        // Swap the two "tail->next" pointers: one ring, dst then src
+        SLink* dstHead = dst->tail->next;
+        dst->tail->next = src->tail->next;
+        src->tail->next = dstHead;
+    }
+    dst->tail = src->tail;
+    dst->count += src->count;
+    clistInit(src);
+}
+
+// ---------------- Node pool ----------------
+
+#define POOL_BLOCK_BYTES 65536
+
+struct NodePoolBlock {
+    struct NodePoolBlock* next;
+    void* objects[];        // perBlock * objSize bytes
+};
+
+void nodePoolInit(NodePool* p, size_t objSize) {
+    // Room for the free list pointer, and keep every object aligned
+    if (objSize < sizeof(void*))
+        objSize = sizeof(void*);
+    objSize = (objSize + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*);
+    p->objSize = objSize;
+    p->perBlock = (POOL_BLOCK_BYTES - sizeof(NodePoolBlock)) / objSize;
+    if (p->perBlock == 0)
+        p->perBlock = 1;
+    p->first = p->current = NULL;
+    p->used = 0;
+    p->freeList = NULL;
+}
+
+void* nodePoolGet(NodePool* p) {
+    if (p->freeList) {
+        void* obj = p->freeList;
+        p->freeList = *(void**)obj;
+        return obj;
+    }
+    if (!p->current || p->used == p->perBlock) {
+        // After a reset the old blocks are still chained up: reuse them first
+        NodePoolBlock* next = p->current ? p->current->next : p->first;
+        if (!next) {
+            next = malloc(sizeof(NodePoolBlock) + p->perBlock * p->objSize);
+            if (!next)
+                return NULL;
+            next->next = NULL;
+            if (p->current)
+                p->current->next = next;
+            else
+                p->first = next;
+        }
+        p->current = next;
+        p->used = 0;
+    }
+    return (char*)p->current->objects + p->used++ * p->objSize;
+}
+
+void nodePoolPut(NodePool* p, void* obj) {
+    *(void**)obj = p->freeList;
+    p->freeList = obj;
+}
+
+void nodePoolReset(NodePool* p) {
+    p->current = NULL;
+    p->used = 0;
+    p->freeList = NULL;
+}
+
+void nodePoolDestroy(NodePool* p) {
+    NodePoolBlock* b = p->first;
+    while (b) {
+        NodePoolBlock* next = b->next;
+        free(b);
+        b = next;
+    }
+    p->first = p->current = NULL;
+    p->used = 0;
+    p->freeList = NULL;
+}
@@ -0,0 +1,112 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <stddef.h>
+
+// Intrusive linked lists: instead of a struct Node holding your data,
+// your struct holds the link, e.g.
+//
+//     struct Process {
+//         int pid, burst;
+//         DLink link;
+//     };
+//
+// and LIST_ENTRY(p, struct Process, link) gets back from a DLink* to the
+// struct Process around it. The lists never allocate; take the nodes from
+// a NodePool (below) or from an array, the stack, anywhere.
+//
+// SList: singly linked, NULL terminated, with a tail (sll_*.c, singly.c)
+// DList: doubly linked ring around a sentinel, so it is also the
+//        circular doubly linked list (dll_operation.c, cdll.c)
+// CList: circular singly linked, kept by its tail (csll.c)
+// Every operation below is O(1), including splicing two lists together.
+// dll_operation.c, cdll.c and csll.c are written on top of these lists.
+
+#define LIST_ENTRY(ptr, type, member) ((type*)((char*)(ptr) - offsetof(type, member)))
+
+// ---------------- Singly linked ----------------
+typedef struct SLink {
+    struct SLink* next;
+} SLink;
+
+typedef struct {
+    SLink* head;
+    SLink* tail;
+    size_t count;
+} SList;
+
+void slistInit(SList* l);
+void slistPushFront(SList* l, SLink* link);
+void slistPushBack(SList* l, SLink* link);
+SLink* slistPopFront(SList* l);                         // NULL if empty
+void slistInsertAfter(SList* l, SLink* pos, SLink* link); // pos NULL = front
+SLink* slistRemoveAfter(SList* l, SLink* pos);          // pos NULL = front, NULL if none
+void slistSplice(SList* dst, SList* src);               // append src to dst, src left empty
+
+// ---------------- Doubly linked (circular, with sentinel) ----------------
+typedef struct DLink {
+    struct DLink* next;
+    struct DLink* prev;
+} DLink;
+
+typedef struct {
+    DLink head;             // sentinel: head.next is the first item, head.prev the last
+    size_t count;
+} DList;
+
+// Walk every link: for (DLink* p = DLIST_FIRST(l); p != DLIST_END(l); p = p->next)
+#define DLIST_FIRST(l) ((l)->head.next)
+#define DLIST_END(l) (&(l)->head)
+
+// A DList must not be copied by value once initialised (the ring points at its sentinel)
+void dlistInit(DList* l);
+DLink* dlistFirst(const DList* l);                      // NULL if empty
+DLink* dlistLast(const DList* l);                       // NULL if empty
+void dlistPushFront(DList* l, DLink* link);
+void dlistPushBack(DList* l, DLink* link);
+void dlistInsertAfter(DList* l, DLink* pos, DLink* link);
+void dlistInsertBefore(DList* l, DLink* pos, DLink* link);
+void dlistRemove(DList* l, DLink* link);
+DLink* dlistPopFront(DList* l);                         // NULL if empty
+DLink* dlistPopBack(DList* l);                          // NULL if empty
+void dlistSplice(DList* dst, DList* src);               // append src to dst, src left empty
+
+// ---------------- Circular singly linked ----------------
+typedef struct {
+    SLink* tail;            // tail->next is the head, NULL if empty
+    size_t count;
+} CList;
+
+void clistInit(CList* l);
+SLink* clistFirst(const CList* l);                      // NULL if empty
+void clistPushFront(CList* l, SLink* link);
+void clistPushBack(CList* l, SLink* link);
+SLink* clistPopFront(CList* l);                         // NULL if empty
+void clistInsertAfter(CList* l, SLink* pos, SLink* link); // pos == tail appends
+SLink* clistRemoveAfter(CList* l, SLink* pos);          // removes pos->next
+void clistRotate(CList* l);                             // head moves to the back (round robin)
+void clistSplice(CList* dst, CList* src);               // append src to dst, src left empty
+
+// ---------------- Node pool ----------------
+// Hands out fixed-size objects carved from big blocks instead of one
+// malloc per node: no per-node header, nodes allocated together sit
+// next to each other in memory, and everything is released at once.
+// Objects are aligned to sizeof(void*).
+typedef struct NodePoolBlock NodePoolBlock;
+
+typedef struct {
+    size_t objSize;
+    size_t perBlock;        // objects per block
+    NodePoolBlock* first;   // blocks in allocation order
+    NodePoolBlock* current; // block being carved up
+    size_t used;            // objects handed out from current
+    void* freeList;         // objects given back with nodePoolPut
+} NodePool;
+
+void nodePoolInit(NodePool* p, size_t objSize);
+void* nodePoolGet(NodePool* p);                         // NULL if out of memory
+void nodePoolPut(NodePool* p, void* obj);               // give one object back for reuse
+void nodePoolReset(NodePool* p);                        // O(1): every object is free again, blocks are kept
+void nodePoolDestroy(NodePool* p);                      // one free() per block, not per node
+
+#endif
@@ -0,0 +1,41 @@
+#include <stdlib.h>
+#include "locked_queue.h"
+
+int lockedInit(LockedQueue* q, size_t capacity) {
+    q->items = malloc(capacity * sizeof(uint64_t));
+    if (!q->items)
+        return 0;
+    pthread_mutex_init(&q->lock, NULL);
+    q->capacity = capacity;
+    q->front = q->count = 0;
+    return 1;
+}
+
+void lockedFree(LockedQueue* q) {
+    pthread_mutex_destroy(&q->lock);
+    free(q->items);
+    q->items = NULL;
+}
+
+size_t lockedEnqueueN(LockedQueue* q, const uint64_t* values, size_t n) {
+    pthread_mutex_lock(&q->lock);
+    size_t moved = 0;
+    while (moved < n && q->count < q->capacity) {
+        q->items[(q->front + q->count) % q->capacity] = values[moved++];
+        q->count++;
+    }
+    pthread_mutex_unlock(&q->lock);
+    return moved;
+}
+
+size_t lockedDequeueN(LockedQueue* q, uint64_t* out, size_t max) {
+    pthread_mutex_lock(&q->lock);
+    size_t moved = 0;
+    while (moved < max && q->count > 0) {
+        out[moved++] = q->items[q->front];
+        q->front = (q->front + 1) % q->capacity;
+        q->count--;
+    }
+    pthread_mutex_unlock(&q->lock);
+    return moved;
+}
@@ -0,0 +1,25 @@
+#ifndef LOCKED_QUEUE_H
+#define LOCKED_QUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+
+// The baseline the ring benchmarks compare against: circle_queue.c's
+// array queue of uint64_t, made thread-safe with one mutex. Any number
+// of threads may call it; every call holds the lock for its whole run.
+
+typedef struct {
+    pthread_mutex_t lock;
+    uint64_t* items;
+    size_t capacity;
+    size_t front, count;
+} LockedQueue;
+
+int lockedInit(LockedQueue* q, size_t capacity);        // 0 if out of memory
+void lockedFree(LockedQueue* q);
+// Move up to n values, return how many moved (0 if full / empty)
+size_t lockedEnqueueN(LockedQueue* q, const uint64_t* values, size_t n);
+size_t lockedDequeueN(LockedQueue* q, uint64_t* out, size_t max);
+
+#endif
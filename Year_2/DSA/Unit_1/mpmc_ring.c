@@ -0,0 +1,86 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mpmc_ring.h"
+
+// Every cell has a sequence number that says whose turn it is.
+// For the cell at position pos (slot pos & mask):
+//   seq == pos         empty, the producer that claims pos may write it
+//   seq == pos + 1     full, the consumer that claims pos may read it
+// After reading, the consumer sets seq = pos + capacity: empty again,
+// for the producer one lap later.
+// A thread claims a position with one CAS on enqueuePos / dequeuePos,
+// then copies the element and publishes it with a release store of seq.
+
+#define SEQ(r, pos) ((atomic_size_t*)((r)->cells + ((pos) & (r)->mask) * (r)->stride))
+#define ELEM(r, pos) ((r)->cells + ((pos) & (r)->mask) * (r)->stride + sizeof(atomic_size_t))
+
+int ringInit(MpmcRing* r, size_t capacity, size_t elemSize) {
+    size_t size = 2;
+    while (size < capacity)
+        size *= 2;
+    r->mask = size - 1;
+    r->elemSize = elemSize;
+    // Round each cell up so the sequence numbers stay aligned
+    r->stride = (sizeof(atomic_size_t) + elemSize + sizeof(atomic_size_t) - 1)
+        / sizeof(atomic_size_t) * sizeof(atomic_size_t);
+    size_t bytes = (size * r->stride + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+    r->cells = aligned_alloc(CACHE_LINE, bytes);
+    if (!r->cells)
+        return 0;
+    for (size_t i = 0; i < size; i++)
+        atomic_init(SEQ(r, i), i);
+    atomic_init(&r->enqueuePos, 0);
+    atomic_init(&r->dequeuePos, 0);
+    return 1;
+}
+
+void ringFree(MpmcRing* r) {
+    free(r->cells);
+    r->cells = NULL;
+}
+
+size_t ringCapacity(const MpmcRing* r) {
+    return r->mask + 1;
+}
+
+int ringTryPush(MpmcRing* r, const void* elem) {
+    size_t pos = atomic_load_explicit(&r->enqueuePos, memory_order_relaxed);
+    while (1) {
+        size_t seq = atomic_load_explicit(SEQ(r, pos), memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            // Slot is free for pos: try to claim it (pos is reloaded on failure)
+            if (atomic_compare_exchange_weak_explicit(&r->enqueuePos, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            return 0;       // Still holds the element from one lap ago: full
+        } else {
+            pos = atomic_load_explicit(&r->enqueuePos, memory_order_relaxed);
+        }
+    }
+    memcpy(ELEM(r, pos), elem, r->elemSize);
+    atomic_store_explicit(SEQ(r, pos), pos + 1, memory_order_release);
+    return 1;
+}
+
+int ringTryPop(MpmcRing* r, void* out) {
+    size_t pos = atomic_load_explicit(&r->dequeuePos, memory_order_relaxed);
+    while (1) {
+        size_t seq = atomic_load_explicit(SEQ(r, pos), memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&r->dequeuePos, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            return 0;       // Producer has not filled it yet: empty
+        } else {
+            pos = atomic_load_explicit(&r->dequeuePos, memory_order_relaxed);
+        }
+    }
+    memcpy(out, ELEM(r, pos), r->elemSize);
+    atomic_store_explicit(SEQ(r, pos), pos + r->mask + 1, memory_order_release);
+    return 1;
+}
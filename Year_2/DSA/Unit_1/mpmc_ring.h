@@ -0,0 +1,36 @@
+#ifndef MPMC_RING_H
+#define MPMC_RING_H
+
+#include <stddef.h>
+#include <stdatomic.h>
+
+// Bounded multi-producer multi-consumer queue (Dmitry Vyukov's design).
+// Any number of threads may push and pop at the same time, no locks.
+// Capacity is rounded up to a power of two so slot = position & mask.
+// Elements are copied in and out (elemSize bytes each), like DaryHeap.
+//
+// Declare MpmcRing as a global or local variable; if you malloc it,
+// use aligned_alloc(CACHE_LINE, ...) so the padding below is kept.
+
+#ifndef CACHE_LINE
+#define CACHE_LINE 64
+#endif
+
+typedef struct {
+    // Producers only touch enqueuePos, consumers only dequeuePos:
+    // separate cache lines so they do not slow each other down
+    _Alignas(CACHE_LINE) atomic_size_t enqueuePos;
+    _Alignas(CACHE_LINE) atomic_size_t dequeuePos;
+    _Alignas(CACHE_LINE) char* cells;       // never changes after ringInit
+    size_t mask;
+    size_t elemSize;
+    size_t stride;          // bytes per cell: sequence number + element
+} MpmcRing;
+
+int ringInit(MpmcRing* r, size_t capacity, size_t elemSize);    // 0 if out of memory
+void ringFree(MpmcRing* r);
+size_t ringCapacity(const MpmcRing* r);
+int ringTryPush(MpmcRing* r, const void* elem); // 0 if full
+int ringTryPop(MpmcRing* r, void* out);         // 0 if empty
+
+#endif
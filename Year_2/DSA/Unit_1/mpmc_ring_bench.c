@@ -0,0 +1,143 @@
+// Producer/consumer throughput: mpmc_ring.c against the same circular
+// queue idea as circle_queue.c, made thread-safe with one mutex
+// (locked_queue.c, shared with spsc_ring_bench.c).
+// Every producer pushes its share of the items, the consumers pop until
+// they see a STOP item; the sum of everything popped is checked.
+//
+// Compile: gcc -O2 -pthread mpmc_ring_bench.c mpmc_ring.c locked_queue.c -o ringbench
+// Run:     ./ringbench [items] [capacity]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include "mpmc_ring.h"
+#include "locked_queue.h"
+
+#define STOP UINT64_MAX
+
+// ---------------- Benchmark ----------------
+typedef int (*TryPush)(void* queue, const void* elem);
+typedef int (*TryPop)(void* queue, void* out);
+
+int ringPush(void* queue, const void* elem) { return ringTryPush(queue, elem); }
+int ringPop(void* queue, void* out) { return ringTryPop(queue, out); }
+int lockedPush(void* queue, const void* elem) { return lockedEnqueueN(queue, elem, 1) == 1; }
+int lockedPop(void* queue, void* out) { return lockedDequeueN(queue, out, 1) == 1; }
+
+typedef struct {
+    void* queue;
+    TryPush push;
+    TryPop pop;
+    uint64_t first, count;      // Producer: pushes first .. first+count-1
+    uint64_t sum, popped;       // Consumer results
+} Worker;
+
+// Full / empty: let another thread run (matters when threads > cores)
+void pushWait(Worker* w, uint64_t value) {
+    while (!w->push(w->queue, &value)) sched_yield();
+}
+
+void* producer(void* arg) {
+    Worker* w = arg;
+    for (uint64_t i = 0; i < w->count; i++) pushWait(w, w->first + i);
+    return NULL;
+}
+
+void* consumer(void* arg) {
+    Worker* w = arg;
+    uint64_t value;
+    while (1) {
+        if (!w->pop(w->queue, &value)) {
+            sched_yield();
+            continue;
+        }
+        if (value == STOP) break;
+        w->sum += value;
+        w->popped++;
+    }
+    return NULL;
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Returns items per second, or -1 if something was lost or duplicated
+double runOnce(void* queue, TryPush push, TryPop pop, int producers, int consumers, uint64_t items) {
+    pthread_t tids[producers + consumers];
+    Worker workers[producers + consumers];
+    uint64_t per = items / producers;
+    items = per * producers;
+
+    double t = nowSeconds();
+    for (int i = 0; i < producers + consumers; i++) {
+        workers[i] = (Worker){ queue, push, pop, 0, 0, 0, 0 };
+        if (i < producers) {
+            workers[i].first = i * per;
+            workers[i].count = per;
+            pthread_create(&tids[i], NULL, producer, &workers[i]);
+        } else {
+            pthread_create(&tids[i], NULL, consumer, &workers[i]);
+        }
+    }
+    for (int i = 0; i < producers; i++) pthread_join(tids[i], NULL);
+    for (int i = 0; i < consumers; i++) pushWait(&workers[0], STOP);
+    uint64_t sum = 0, popped = 0;
+    for (int i = producers; i < producers + consumers; i++) {
+        pthread_join(tids[i], NULL);
+        sum += workers[i].sum;
+        popped += workers[i].popped;
+    }
+    double seconds = nowSeconds() - t;
+
+    if (popped != items || sum != items * (items - 1) / 2) return -1;
+    return items / seconds;
+}
+
+int main(int argc, char* argv[]) {
+    uint64_t items = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+    size_t capacity = argc > 2 ? strtoul(argv[2], NULL, 10) : 1024;
+
+    // Single-threaded demo, same steps as circle_queue.c
+    MpmcRing demo;
+    ringInit(&demo, 5, sizeof(int));
+    printf("Capacity 5 rounds up to %zu\n", ringCapacity(&demo));
+    int value;
+    for (value = 10; value <= 100; value += 10)
+        if (!ringTryPush(&demo, &value)) printf("Queue Overflow at %d\n", value);
+    while (ringTryPop(&demo, &value)) printf("%d dequeued\n", value);
+    printf("Queue Underflow: %s\n\n", ringTryPop(&demo, &value) ? "no" : "yes");
+    ringFree(&demo);
+
+    MpmcRing ring;
+    LockedQueue locked;
+    ringInit(&ring, capacity, sizeof(uint64_t));
+    lockedInit(&locked, ringCapacity(&ring));
+
+    printf("%llu items, capacity %zu, %ld core(s) online\n",
+           (unsigned long long)items, ringCapacity(&ring), sysconf(_SC_NPROCESSORS_ONLN));
+    printf("Producers x Consumers | Lock-free M items/s | Mutex M items/s\n");
+    printf("----------------------+---------------------+----------------\n");
+
+    int shapes[][2] = { { 1, 1 }, { 2, 2 }, { 4, 1 }, { 1, 4 }, { 4, 4 }, { 8, 8 } };
+    for (int s = 0; s < 6; s++) {
+        int p = shapes[s][0], c = shapes[s][1];
+        double lockFree = runOnce(&ring, ringPush, ringPop, p, c, items);
+        double mutex = runOnce(&locked, lockedPush, lockedPop, p, c, items);
+        printf("%9d x %-9d | ", p, c);
+        if (lockFree < 0) printf("%19s | ", "LOST ITEMS");
+        else printf("%19.1f | ", lockFree / 1e6);
+        if (mutex < 0) printf("%s\n", "LOST ITEMS");
+        else printf("%.1f\n", mutex / 1e6);
+    }
+
+    ringFree(&ring);
+    lockedFree(&locked);
+    return 0;
+}
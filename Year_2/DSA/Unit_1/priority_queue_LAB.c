@@ -1,26 +1,42 @@
+// Compile: gcc priority_queue_LAB.c dary_heap.c -o stones
 #include <stdio.h>
+#include "dary_heap.h"
 
-// Insert value in priority queue
-void insertPQ(int pq[], int *size, int value) {
-   //implement insertPq function
+// The lab's two operations, on the d-ary heap from dary_heap.c
+// (a max-heap of ints, so it grows instead of overflowing pq[])
+void insertPQ(DaryHeap* pq, int value) {
+    heapPush(pq, &value);
 }
 
-// Delete the maximum (first element)
-int deleteMaxPQ(int pq[], int *size) {
-    //implement deleteMaxPQ function
+// Delete the maximum; -1 if the queue is empty (stones are positive)
+int deleteMaxPQ(DaryHeap* pq) {
+    int max;
+    if (!heapPop(pq, &max)) return -1;
+    return max;
 }
 
+int compareInt(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Runs on the growable heap, so there is no limit on stonesSize
 int lastStoneWeight(int* stones, int stonesSize) {
-    int pq[100];
-    int size = 0;
+    DaryHeap pq;
+    heapInit(&pq, sizeof(int), 4, compareInt);
 
-    // Insert all stones into priority queue
-    for (int i = 0; i < stonesSize; i++) {
-        insertPQ(pq, &size, stones[i]);
-    }
+    // Insert all stones into priority queue: heapify is O(n)
+    heapify(&pq, stones, stonesSize);
 
-    // Implement code to find the last Stone weight here.
-    
+    // Smash the two heaviest until at most one stone is left
+    while (heapSize(&pq) > 1) {
+        int y = deleteMaxPQ(&pq);
+        int x = deleteMaxPQ(&pq);
+        if (x != y) insertPQ(&pq, y - x);
+    }
+    int result = heapSize(&pq) ? *(int*)heapPeek(&pq) : 0;
+    heapFree(&pq);
+    return result;
 }
 
 int main() {
@@ -1,8 +1,8 @@
+// Compile: gcc priority_queue_LAB2.c dary_heap.c -o ranks
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-
-#define MAX_SIZE 1000  
+#include "dary_heap.h"
 
 // ---------------- Athlete Struct ----------------
 typedef struct {
@@ -10,24 +10,32 @@ typedef struct {
     int index;
 } Athlete;
 
-// ---------------- Priority Queue (Array-based) ----------------
+// ---------------- Priority Queue (d-ary heap, grows as needed) ----------------
 typedef struct {
-    Athlete data[MAX_SIZE];
-    int size;
+    DaryHeap heap;
 } PriorityQueue;
 
+int compareAthlete(const void* a, const void* b){
+    int x = ((const Athlete*)a)->score, y = ((const Athlete*)b)->score;
+    return (x > y) - (x < y);
+}
 
 void initPQ(PriorityQueue* pq){
      // Initialize priority queue
+    heapInit(&pq->heap, sizeof(Athlete), 4, compareAthlete);
 }
 
 
 void pushPQ(PriorityQueue* pq, Athlete athlete){
-     // Insert athlete into priority queue in descending order
+     // Insert athlete into priority queue (largest score on top)
+    heapPush(&pq->heap, &athlete);
 }
 
 Athlete popPQ(PriorityQueue* pq){
      // Remove max element (largest score)
+    Athlete top = { 0, -1 };
+    heapPop(&pq->heap, &top);
+    return top;
 }
 
 // ---------------- Functions to be implemented ----------------
@@ -48,6 +56,23 @@ void getRankString(int rank, char* rankStr){
 
 void findRelativeRanks(int* scores, int scoresSize, char** result){
      // Main function to find relative ranks using priority queue
+    Athlete* athletes = (Athlete*)malloc(scoresSize * sizeof(Athlete));
+    for (int i = 0; i < scoresSize; i++) {
+        athletes[i].score = scores[i];
+        athletes[i].index = i;
+    }
+
+    // Build the queue in O(n), then pop in score order
+    PriorityQueue pq;
+    initPQ(&pq);
+    heapify(&pq.heap, athletes, scoresSize);
+    for (int rank = 1; rank <= scoresSize; rank++) {
+        Athlete a = popPQ(&pq);
+        getRankString(rank, result[a.index]);
+    }
+
+    heapFree(&pq.heap);
+    free(athletes);
 }
 
 // ---------------- Main Function ----------------
@@ -0,0 +1,235 @@
+// Skip list search latency: separate forward array vs inline + node pool
+//
+// Old layout (skiplist_operations.c before): two mallocs per node
+//     node --> { key, forward* } --> [ next0, next1, ... ]
+//   every level hop reads the node AND its separate forward array
+//   (two cache misses).
+//
+// New layout: forward[] is a flexible array member inside the node, and
+// nodes come from a size-class pool (one class per level count)
+//     node --> { key, next0, next1, ... }
+//   one cache miss per hop, no malloc header between nodes.
+//
+// Both lists get exactly the same keys, levels and insert order, so the
+// only difference is the memory layout.
+//
+// Compile: gcc -O2 skiplist_layout_bench.c ../common/skiplist_common.c -o layout
+// Run:     ./layout [maxKeys] [lookups]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../common/skiplist_common.h"
+
+#define MAXLVL 32
+
+unsigned int seed = 2463534242u;
+
+unsigned int nextRandom() {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+// ---- Old layout ----
+typedef struct oldnode {
+    int key;
+    struct oldnode **forward;
+} oldnode;
+
+typedef struct {
+    int level;
+    oldnode *header;
+} oldlist;
+
+oldnode* oldCreateNode(int key, int level) {
+    oldnode* n = malloc(sizeof(oldnode));
+    n->key = key;
+    n->forward = malloc(sizeof(oldnode*) * (level + 1));
+    for (int i = 0; i <= level; i++)
+        n->forward[i] = NULL;
+    return n;
+}
+
+void oldInsert(oldlist *list, int key, int lvl) {
+    oldnode *update[MAXLVL+1];
+    oldnode *x = list->header;
+    for (int i = list->level; i >= 0; i--) {
+        while (x->forward[i] && x->forward[i]->key < key)
+            x = x->forward[i];
+        update[i] = x;
+    }
+    if (lvl > list->level) {
+        for (int i = list->level + 1; i <= lvl; i++)
+            update[i] = list->header;
+        list->level = lvl;
+    }
+    x = oldCreateNode(key, lvl);
+    for (int i = 0; i <= lvl; i++) {
+        x->forward[i] = update[i]->forward[i];
+        update[i]->forward[i] = x;
+    }
+}
+
+oldnode* oldSearch(oldlist *list, int key) {
+    oldnode *x = list->header;
+    for (int i = list->level; i >= 0; i--) {
+        while (x->forward[i] && x->forward[i]->key < key)
+            x = x->forward[i];
+    }
+    x = x->forward[0];
+    return (x && x->key == key) ? x : NULL;
+}
+
+void oldFree(oldlist *list) {
+    oldnode *x = list->header;
+    while (x) {
+        oldnode *next = x->forward[0];
+        free(x->forward);
+        free(x);
+        x = next;
+    }
+}
+
+// ---- New layout: inline forward array + size-class pool (skiplist_common.c) ----
+typedef struct snode {
+    int key;
+    struct snode *forward[];
+} snode;
+
+typedef struct {
+    int level;
+    snode *header;
+    SkipNodePool pool;
+} newlist;
+
+snode* newCreateNode(newlist* list, int key, int level) {
+    snode* n = skipPoolAlloc(&list->pool, level);
+    if (!n) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    n->key = key;
+    for (int i = 0; i <= level; i++)
+        n->forward[i] = NULL;
+    return n;
+}
+
+void newInsert(newlist *list, int key, int lvl) {
+    snode *update[MAXLVL+1];
+    snode *x = list->header;
+    for (int i = list->level; i >= 0; i--) {
+        while (x->forward[i] && x->forward[i]->key < key)
+            x = x->forward[i];
+        update[i] = x;
+    }
+    if (lvl > list->level) {
+        for (int i = list->level + 1; i <= lvl; i++)
+            update[i] = list->header;
+        list->level = lvl;
+    }
+    x = newCreateNode(list, key, lvl);
+    for (int i = 0; i <= lvl; i++) {
+        x->forward[i] = update[i]->forward[i];
+        update[i]->forward[i] = x;
+    }
+}
+
+snode* newSearch(newlist *list, int key) {
+    snode *x = list->header;
+    for (int i = list->level; i >= 0; i--) {
+        while (x->forward[i] && x->forward[i]->key < key)
+            x = x->forward[i];
+    }
+    x = x->forward[0];
+    return (x && x->key == key) ? x : NULL;
+}
+
+// ---- Benchmark ----
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Same level for both lists: P = 0.5, at most about log2(n) levels
+int randomLevel(int maxLevel) {
+    int lvl = 0;
+    while ((nextRandom() & 1) && lvl < maxLevel)
+        lvl++;
+    return lvl;
+}
+
+void runSize(int n, int lookups) {
+    int maxLevel = 0;
+    while ((1 << maxLevel) < n && maxLevel < MAXLVL) maxLevel++;
+
+    // Keys 0, 2, 4, ... in random order (lookups hit and miss half each)
+    int* keys = malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) keys[i] = 2 * i;
+    for (int i = n - 1; i > 0; i--) {
+        int j = nextRandom() % (i + 1);
+        int t = keys[i]; keys[i] = keys[j]; keys[j] = t;
+    }
+    int* levels = malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) levels[i] = randomLevel(maxLevel);
+    int* queries = malloc(lookups * sizeof(int));
+    for (int i = 0; i < lookups; i++) queries[i] = nextRandom() % (2 * n);
+
+    oldlist oldList = { 0, oldCreateNode(-1, MAXLVL) };
+    double t = nowSeconds();
+    for (int i = 0; i < n; i++) oldInsert(&oldList, keys[i], levels[i]);
+    double oldBuild = nowSeconds() - t;
+
+    newlist newList = { 0 };
+    skipPoolInit(&newList.pool, sizeof(snode), sizeof(snode*));
+    newList.header = newCreateNode(&newList, -1, MAXLVL);
+    t = nowSeconds();
+    for (int i = 0; i < n; i++) newInsert(&newList, keys[i], levels[i]);
+    double newBuild = nowSeconds() - t;
+
+    long oldFound = 0, newFound = 0;
+    t = nowSeconds();
+    for (int i = 0; i < lookups; i++) oldFound += oldSearch(&oldList, queries[i]) != NULL;
+    double oldSearchTime = nowSeconds() - t;
+
+    t = nowSeconds();
+    for (int i = 0; i < lookups; i++) newFound += newSearch(&newList, queries[i]) != NULL;
+    double newSearchTime = nowSeconds() - t;
+
+    printf("%9d | %9.0f | %9.0f | %6.2fx | %8.0f | %8.0f | %s\n", n,
+           oldSearchTime / lookups * 1e9, newSearchTime / lookups * 1e9,
+           oldSearchTime / newSearchTime,
+           oldBuild / n * 1e9, newBuild / n * 1e9,
+           oldFound == newFound ? "yes" : "NO");
+
+    oldFree(&oldList);
+    skipPoolDestroy(&newList.pool);
+    free(keys);
+    free(levels);
+    free(queries);
+}
+
+int main(int argc, char* argv[]) {
+    int maxKeys = argc > 1 ? atoi(argv[1]) : 4000000;
+    int lookups = argc > 2 ? atoi(argv[2]) : 1000000;
+
+    // Pool reuses freed nodes of the same size class
+    SkipNodePool pool;
+    skipPoolInit(&pool, sizeof(snode), sizeof(snode*));
+    snode* a = skipPoolAlloc(&pool, 3);
+    skipPoolFree(&pool, a, 3);
+    printf("Freed node reused by next alloc of same size: %s\n\n",
+           skipPoolAlloc(&pool, 3) == a ? "yes" : "no");
+    skipPoolDestroy(&pool);
+
+    printf("Average search latency, %d random lookups per size\n", lookups);
+    printf("     Keys | Old ns    | New ns    | Faster  | Old ins  | New ins  | Same results\n");
+    printf("----------+-----------+-----------+---------+----------+----------+-------------\n");
+    for (int n = 10000; n <= maxKeys; n *= 10) {
+        runSize(n, lookups);
+        if (n * 10 > maxKeys && n != maxKeys) runSize(maxKeys, lookups);
+    }
+    return 0;
+}
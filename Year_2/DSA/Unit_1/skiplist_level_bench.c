@@ -0,0 +1,185 @@
+// Skip list insert throughput with three random level generators
+//
+// 1. rand() once per level (the old randomLevel)
+//    - glibc's rand() locks a global mutex on every call, so threads
+//      inserting into DIFFERENT lists still wait for each other
+// 2. Per-thread xorshift, still one draw per level
+// 3. Per-thread xorshift, ONE draw per node (skipRandomLevel in
+//    skiplist_common.c, used by the other skip list files):
+//      level = number of trailing zero bits (count-trailing-zeros)
+//    bit 0 is the first coin flip, bit 1 the second, ... so P(level >= k)
+//    is 1/2^k, exactly like flipping a coin k times
+//
+// Every thread inserts into its own skip list, so the only thing the
+// threads share is the random number generator.
+//
+// Compile: gcc -O2 -pthread skiplist_level_bench.c ../common/skiplist_common.c -o levels
+// Run:     ./levels [insertsPerThread] [threads]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "../common/skiplist_common.h"
+
+#define MAXLVL 24
+
+typedef struct snode {
+    int key;
+    struct snode *forward[];
+} snode;
+
+typedef struct skiplist {
+    int level;
+    snode *header;
+} skiplist;
+
+// Per-thread generator state (never shared, so no lock)
+_Thread_local unsigned int xorshiftState = 0;
+
+unsigned int xorshift() {
+    if (xorshiftState == 0)
+        xorshiftState = 2463534242u ^ (unsigned int)(size_t)&xorshiftState;
+    xorshiftState ^= xorshiftState << 13;
+    xorshiftState ^= xorshiftState >> 17;
+    xorshiftState ^= xorshiftState << 5;
+    return xorshiftState;
+}
+
+int randomLevelRand() {
+    int lvl = 0;
+    while ((rand() / (double)RAND_MAX) < 0.5 && lvl < MAXLVL)
+        lvl++;
+    return lvl;
+}
+
+int randomLevelXorshift() {
+    int lvl = 0;
+    while ((xorshift() & 1) && lvl < MAXLVL)
+        lvl++;
+    return lvl;
+}
+
+int randomLevelCtz() {
+    return skipRandomLevel(MAXLVL, 1);
+}
+
+snode* createNode(int key, int level) {
+    snode* n = malloc(sizeof(snode) + sizeof(snode*) * (level + 1));
+    n->key = key;
+    for (int i = 0; i <= level; i++)
+        n->forward[i] = NULL;
+    return n;
+}
+
+void insert(skiplist *list, int key, int lvl) {
+    snode *update[MAXLVL+1];
+    snode *x = list->header;
+    for (int i = list->level; i >= 0; i--) {
+        while (x->forward[i] && x->forward[i]->key < key)
+            x = x->forward[i];
+        update[i] = x;
+    }
+    x = x->forward[0];
+    if (x && x->key == key) return;
+    if (lvl > list->level) {
+        for (int i = list->level + 1; i <= lvl; i++)
+            update[i] = list->header;
+        list->level = lvl;
+    }
+    x = createNode(key, lvl);
+    for (int i = 0; i <= lvl; i++) {
+        x->forward[i] = update[i]->forward[i];
+        update[i]->forward[i] = x;
+    }
+}
+
+void freeList(skiplist *list) {
+    snode *x = list->header;
+    while (x) {
+        snode *next = x->forward[0];
+        free(x);
+        x = next;
+    }
+}
+
+typedef struct {
+    int (*randomLevel)();
+    int inserts;
+    long levelSum;
+} ThreadArgs;
+
+void* insertWorker(void* arg) {
+    ThreadArgs* t = arg;
+    skiplist list = { 0, createNode(-1, MAXLVL) };
+    unsigned int keySeed = 12345u + (unsigned int)(size_t)t;
+    for (int i = 0; i < t->inserts; i++) {
+        keySeed = keySeed * 1103515245u + 12345u;    // Keys: own LCG, not shared
+        int lvl = t->randomLevel();
+        t->levelSum += lvl;
+        insert(&list, (int)(keySeed >> 1), lvl);
+    }
+    freeList(&list);
+    return NULL;
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Returns total inserts per second over all threads
+double run(int (*randomLevel)(), int threads, int inserts, double* averageLevel) {
+    pthread_t tids[64];
+    ThreadArgs args[64];
+    double t = nowSeconds();
+    for (int i = 0; i < threads; i++) {
+        args[i] = (ThreadArgs){ randomLevel, inserts, 0 };
+        pthread_create(&tids[i], NULL, insertWorker, &args[i]);
+    }
+    long levelSum = 0;
+    for (int i = 0; i < threads; i++) {
+        pthread_join(tids[i], NULL);
+        levelSum += args[i].levelSum;
+    }
+    double elapsed = nowSeconds() - t;
+    *averageLevel = (double)levelSum / ((double)threads * inserts);
+    return (double)threads * inserts / elapsed;
+}
+
+int main(int argc, char* argv[]) {
+    int inserts = argc > 1 ? atoi(argv[1]) : 200000;
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int threads = argc > 2 ? atoi(argv[2]) : (int)(cores < 2 ? 2 : cores);
+    if (threads < 1) threads = 1;
+    if (threads > 64) threads = 64;
+
+    // Raw generator cost, no skip list
+    const char* names[] = { "rand() per level", "xorshift per level", "xorshift + ctz" };
+    int (*generators[])() = { randomLevelRand, randomLevelXorshift, randomLevelCtz };
+    printf("Level generator cost (single thread, 10M levels):\n");
+    for (int g = 0; g < 3; g++) {
+        long sum = 0;
+        double t = nowSeconds();
+        for (int i = 0; i < 10000000; i++) sum += generators[g]();
+        double elapsed = nowSeconds() - t;
+        printf("  %-20s %6.2f ns per level (average level %.3f)\n",
+               names[g], elapsed / 1e7 * 1e9, sum / 1e7);
+    }
+
+    printf("\nInsert throughput, %d inserts per thread, %ld core(s) online\n", inserts, cores);
+    printf("Generator            | Threads | Million inserts/s | Avg level\n");
+    printf("---------------------+---------+-------------------+----------\n");
+    for (int g = 0; g < 3; g++) {
+        int counts[] = { 1, threads };
+        for (int c = 0; c < 2; c++) {
+            if (c == 1 && threads == 1) break;
+            double averageLevel;
+            double rate = run(generators[g], counts[c], inserts, &averageLevel);
+            printf("%-20s | %7d | %17.2f | %8.3f\n", names[g], counts[c], rate / 1e6, averageLevel);
+        }
+    }
+    return 0;
+}
@@ -1,21 +1,28 @@
+// Compile: gcc skiplist_operations.c ../common/skiplist_common.c -o skiplist
 #include <stdio.h>
 #include <stdlib.h>
+#include "../common/skiplist_common.h"
 #define MAXLVL 3
-#define P 0.5
 
+// forward[] is stored inside the node (one allocation, no extra hop)
 typedef struct snode {
     int key;
-    struct snode **forward;
+    struct snode *forward[];
 } snode;
 
 typedef struct skiplist {
     int level;
     struct snode *header;
+    SkipNodePool pool;          // Nodes of this list only (skiplist_common.c)
 } skiplist;
 
 skiplist* createList();
-snode* createNode(int, int);
+snode* createNode(skiplist*, int, int);
 int randomLevel();
+void insert(skiplist *list, int key);
+snode* search(skiplist *list, int key);
+int deleteKey(skiplist *list, int key);
+void destroyList(skiplist *list);
 
 int main() {
     skiplist* list = createList();
@@ -23,11 +30,36 @@ int main() {
     printf("Enter a key to insert into the skip list: ");
     scanf("%d", &key);
     insert(list, key);
+    printf("Enter a key to search for: ");
+    scanf("%d", &key);
+    printf(search(list, key) ? "Found\n" : "Not found\n");
+    printf("Enter a key to delete: ");
+    scanf("%d", &key);
+    printf(deleteKey(list, key) ? "Deleted\n" : "Not found\n");
+    destroyList(list);
     return 0;
 }
 // (Functions not shown for brevity; see operations code below)
 // Add to the above skip list code
 
+skiplist* createList() {
+    skiplist* list = malloc(sizeof(skiplist));
+    if (!list) return NULL;
+    list->level = 0;
+    skipPoolInit(&list->pool, sizeof(snode), sizeof(snode*));
+    list->header = createNode(list, -1, MAXLVL);
+    if (!list->header) {
+        free(list);
+        return NULL;
+    }
+    return list;
+}
+
+void destroyList(skiplist *list) {
+    skipPoolDestroy(&list->pool);       // Every node, header included
+    free(list);
+}
+
 void insert(skiplist *list, int key) {
     snode *update[MAXLVL+1];
     snode *x = list->header;
@@ -36,7 +68,7 @@ void insert(skiplist *list, int key) {
             x = x->forward[i];
         update[i] = x;
     }
-    x = x->forward;
+    x = x->forward[0];
 
     if (!x || x->key != key) {
         int lvl = randomLevel();
@@ -45,7 +77,8 @@ void insert(skiplist *list, int key) {
                 update[i] = list->header;
             list->level = lvl;
         }
-        x = createNode(key, lvl);
+        x = createNode(list, key, lvl);
+        if (!x) return;                 // Out of memory: list unchanged
         for (int i = 0; i <= lvl; i++) {
             x->forward[i] = update[i]->forward[i];
             update[i]->forward[i] = x;
@@ -53,21 +86,17 @@ void insert(skiplist *list, int key) {
     }
 }
 int randomLevel() {
-    int lvl = 0;
-    while ((rand() / (double)RAND_MAX) < P && lvl < MAXLVL)
-        lvl++;
-    return lvl;
+    return skipRandomLevel(MAXLVL, 1);     // P = 0.5, see skiplist_common.c
 }
-snode* createNode(int key, int level) {
-    snode* n = malloc(sizeof(snode));
+snode* createNode(skiplist *list, int key, int level) {
+    snode* n = skipPoolAlloc(&list->pool, level);
+    if (!n) return NULL;
     n->key = key;
-    n->forward = malloc(sizeof(snode*) * (level + 1));
     for (int i = 0; i <= level; i++)
         n->forward[i] = NULL;
     return n;
 }
-/*
-skiplist* search(skiplist *list, int key) {
+snode* search(skiplist *list, int key) {
     snode *x = list->header;
     for (int i = list->level; i >= 0; i--) {
         while (x->forward[i] && x->forward[i]->key < key)
@@ -78,4 +107,27 @@ skiplist* search(skiplist *list, int key) {
         return x;
     return NULL;
 }
-*/
\ No newline at end of file
+// The node's level is not stored: it is linked on levels 0..level, so
+// count the levels it gets unlinked from to free it to the right class
+int deleteKey(skiplist *list, int key) {
+    snode *update[MAXLVL+1];
+    snode *x = list->header;
+    for (int i = list->level; i >= 0; i--) {
+        while (x->forward[i] && x->forward[i]->key < key)
+            x = x->forward[i];
+        update[i] = x;
+    }
+    x = x->forward[0];
+    if (!x || x->key != key)
+        return 0;
+
+    int lvl = -1;
+    for (int i = 0; i <= list->level && update[i]->forward[i] == x; i++) {
+        update[i]->forward[i] = x->forward[i];
+        lvl = i;
+    }
+    while (list->level > 0 && !list->header->forward[list->level])
+        list->level--;
+    skipPoolFree(&list->pool, x, lvl);
+    return 1;
+}
@@ -0,0 +1,110 @@
+#include <stdlib.h>
+#include <string.h>
+#include "spsc_ring.h"
+
+// head and tail only ever grow; tail - head is the number of items.
+// Each side owns one index and only reads the other one when its cached
+// copy says the ring looks full (producer) or empty (consumer), so in
+// the common case a call touches no cache line written by the other thread.
+
+#define AT(r, pos) ((r)->items + ((pos) & (r)->mask) * (r)->elemSize)
+
+int spscInit(SpscRing* r, size_t capacity, size_t elemSize) {
+    size_t size = 2;
+    while (size < capacity)
+        size *= 2;
+    r->mask = size - 1;
+    r->elemSize = elemSize;
+    size_t bytes = (size * elemSize + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+    r->items = aligned_alloc(CACHE_LINE, bytes);
+    if (!r->items)
+        return 0;
+    atomic_init(&r->head, 0);
+    atomic_init(&r->tail, 0);
+    r->cachedHead = r->cachedTail = 0;
+    return 1;
+}
+
+void spscFree(SpscRing* r) {
+    free(r->items);
+    r->items = NULL;
+}
+
+size_t spscCapacity(const SpscRing* r) {
+    return r->mask + 1;
+}
+
+// Copy n elements starting at ring position pos, in two pieces if they wrap
+static void copyIn(SpscRing* r, size_t pos, const char* src, size_t n) {
+    size_t first = r->mask + 1 - (pos & r->mask);
+    if (first > n)
+        first = n;
+    memcpy(AT(r, pos), src, first * r->elemSize);
+    memcpy(r->items, src + first * r->elemSize, (n - first) * r->elemSize);
+}
+
+static void copyOut(SpscRing* r, size_t pos, char* dst, size_t n) {
+    size_t first = r->mask + 1 - (pos & r->mask);
+    if (first > n)
+        first = n;
+    memcpy(dst, AT(r, pos), first * r->elemSize);
+    memcpy(dst + first * r->elemSize, r->items, (n - first) * r->elemSize);
+}
+
+size_t spscEnqueueN(SpscRing* r, const void* elems, size_t n) {
+    size_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+    size_t space = r->mask + 1 - (tail - r->cachedHead);
+    if (space < n) {
+        // Looks full: see how far the consumer really got
+        r->cachedHead = atomic_load_explicit(&r->head, memory_order_acquire);
+        space = r->mask + 1 - (tail - r->cachedHead);
+        if (n > space)
+            n = space;
+    }
+    if (n == 0)
+        return 0;
+    copyIn(r, tail, elems, n);
+    atomic_store_explicit(&r->tail, tail + n, memory_order_release);
+    return n;
+}
+
+size_t spscDequeueN(SpscRing* r, void* out, size_t max) {
+    size_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    size_t ready = r->cachedTail - head;
+    if (ready < max) {
+        // Looks empty: see how far the producer really got
+        r->cachedTail = atomic_load_explicit(&r->tail, memory_order_acquire);
+        ready = r->cachedTail - head;
+        if (max > ready)
+            max = ready;
+    }
+    if (max == 0)
+        return 0;
+    copyOut(r, head, out, max);
+    atomic_store_explicit(&r->head, head + max, memory_order_release);
+    return max;
+}
+
+int spscEnqueue(SpscRing* r, const void* elem) {
+    size_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+    if (tail - r->cachedHead > r->mask) {
+        r->cachedHead = atomic_load_explicit(&r->head, memory_order_acquire);
+        if (tail - r->cachedHead > r->mask)
+            return 0;
+    }
+    memcpy(AT(r, tail), elem, r->elemSize);
+    atomic_store_explicit(&r->tail, tail + 1, memory_order_release);
+    return 1;
+}
+
+int spscDequeue(SpscRing* r, void* out) {
+    size_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    if (head == r->cachedTail) {
+        r->cachedTail = atomic_load_explicit(&r->tail, memory_order_acquire);
+        if (head == r->cachedTail)
+            return 0;
+    }
+    memcpy(out, AT(r, head), r->elemSize);
+    atomic_store_explicit(&r->head, head + 1, memory_order_release);
+    return 1;
+}
@@ -0,0 +1,42 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stddef.h>
+#include <stdatomic.h>
+
+// Bounded single-producer single-consumer queue: exactly ONE thread
+// enqueues and exactly ONE other thread dequeues (e.g. two stages of a
+// pipeline). Neither side ever waits for the other inside a call, so
+// every call finishes in a fixed number of steps (wait-free).
+// Capacity is rounded up to a power of two so slot = position & mask.
+//
+// The batch calls move as many elements as fit in one go and publish
+// them with a single atomic store, which is where most of the speed is.
+// If you malloc an SpscRing, use aligned_alloc(CACHE_LINE, ...).
+
+#ifndef CACHE_LINE
+#define CACHE_LINE 64
+#endif
+
+typedef struct {
+    // Consumer's line: it writes head and keeps its last view of tail
+    _Alignas(CACHE_LINE) atomic_size_t head;
+    size_t cachedTail;
+    // Producer's line: it writes tail and keeps its last view of head
+    _Alignas(CACHE_LINE) atomic_size_t tail;
+    size_t cachedHead;
+    // Read-only after spscInit
+    _Alignas(CACHE_LINE) char* items;
+    size_t mask;
+    size_t elemSize;
+} SpscRing;
+
+int spscInit(SpscRing* r, size_t capacity, size_t elemSize);    // 0 if out of memory
+void spscFree(SpscRing* r);
+size_t spscCapacity(const SpscRing* r);
+int spscEnqueue(SpscRing* r, const void* elem);                 // producer only, 0 if full
+int spscDequeue(SpscRing* r, void* out);                        // consumer only, 0 if empty
+size_t spscEnqueueN(SpscRing* r, const void* elems, size_t n);  // returns how many fit
+size_t spscDequeueN(SpscRing* r, void* out, size_t max);        // returns how many were taken
+
+#endif
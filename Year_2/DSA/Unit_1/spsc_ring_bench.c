@@ -0,0 +1,147 @@
+// Two-stage pipeline benchmark for spsc_ring.c: a producer thread sends
+// 0 .. items-1 to a consumer thread, one at a time and in batches,
+// next to the mutex-protected array queue in locked_queue.c.
+// The threads are pinned to CPU 0 and CPU 1 (both to CPU 0 if there
+// is only one). The consumer checks that every value arrives in order.
+//
+// Compile: gcc -O2 -pthread spsc_ring_bench.c spsc_ring.c locked_queue.c -o spscbench
+// Run:     ./spscbench [items] [capacity] [batch]
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include "spsc_ring.h"
+#include "locked_queue.h"
+
+// ---------------- Benchmark ----------------
+enum Kind { SPSC_ONE, SPSC_BATCH, MUTEX_ONE, MUTEX_BATCH };
+
+typedef struct {
+    enum Kind kind;
+    SpscRing* ring;
+    LockedQueue* locked;
+    uint64_t items;
+    size_t batch;
+    int cpu;
+    int inOrder;
+} Stage;
+
+void pinToCpu(int cpu) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+void* producerStage(void* arg) {
+    Stage* s = arg;
+    pinToCpu(s->cpu);
+    uint64_t* buffer = malloc(s->batch * sizeof(uint64_t));
+    uint64_t next = 0;
+    while (next < s->items) {
+        if (s->kind == SPSC_ONE) {
+            if (spscEnqueue(s->ring, &next)) next++;
+            else sched_yield();
+            continue;
+        }
+        size_t n = s->items - next < s->batch ? s->items - next : s->batch;
+        if (s->kind == MUTEX_ONE) n = 1;
+        for (size_t i = 0; i < n; i++) buffer[i] = next + i;
+        size_t sent = 0;
+        while (sent < n) {
+            size_t moved = s->kind == SPSC_BATCH
+                ? spscEnqueueN(s->ring, buffer + sent, n - sent)
+                : lockedEnqueueN(s->locked, buffer + sent, n - sent);
+            if (moved == 0) sched_yield();
+            sent += moved;
+        }
+        next += n;
+    }
+    free(buffer);
+    return NULL;
+}
+
+void* consumerStage(void* arg) {
+    Stage* s = arg;
+    pinToCpu(s->cpu);
+    uint64_t* buffer = malloc(s->batch * sizeof(uint64_t));
+    uint64_t expected = 0;
+    s->inOrder = 1;
+    while (expected < s->items) {
+        size_t got;
+        if (s->kind == SPSC_ONE) got = spscDequeue(s->ring, buffer);
+        else if (s->kind == SPSC_BATCH) got = spscDequeueN(s->ring, buffer, s->batch);
+        else got = lockedDequeueN(s->locked, buffer, s->kind == MUTEX_ONE ? 1 : s->batch);
+        if (got == 0) {
+            sched_yield();
+            continue;
+        }
+        for (size_t i = 0; i < got; i++)
+            if (buffer[i] != expected++) s->inOrder = 0;
+    }
+    free(buffer);
+    return NULL;
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[]) {
+    uint64_t items = argc > 1 ? strtoull(argv[1], NULL, 10) : 50000000;
+    size_t capacity = argc > 2 ? strtoul(argv[2], NULL, 10) : 4096;
+    size_t batch = argc > 3 ? strtoul(argv[3], NULL, 10) : 256;
+    if (batch < 1) batch = 1;
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+    // Single-threaded demo: batch calls stop at the capacity
+    SpscRing demo;
+    spscInit(&demo, 8, sizeof(int));
+    int in[12] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 }, out[12];
+    printf("enqueue_n of 12 into capacity %zu: %zu fit\n", spscCapacity(&demo), spscEnqueueN(&demo, in, 12));
+    size_t got = spscDequeueN(&demo, out, 5);
+    printf("dequeue_n(5): %zu items, first %d last %d\n", got, out[0], out[got - 1]);
+    printf("enqueue_n of the last 4: %zu fit\n", spscEnqueueN(&demo, in + 8, 4));
+    got = spscDequeueN(&demo, out, 12);
+    printf("dequeue_n(12): %zu items:", got);
+    for (size_t i = 0; i < got; i++) printf(" %d", out[i]);
+    printf("\n\n");
+    spscFree(&demo);
+
+    SpscRing ring;
+    LockedQueue locked;
+    spscInit(&ring, capacity, sizeof(uint64_t));
+    lockedInit(&locked, spscCapacity(&ring));
+    int consumerCpu = cores > 1 ? 1 : 0;
+
+    printf("%llu items, capacity %zu, batch %zu, producer on CPU 0, consumer on CPU %d\n",
+           (unsigned long long)items, spscCapacity(&ring), batch, consumerCpu);
+    printf("Queue                    | M items/s | In order\n");
+    printf("-------------------------+-----------+---------\n");
+
+    const char* names[] = { "SPSC one at a time", "SPSC enqueue_n/dequeue_n", "Mutex one at a time", "Mutex batched" };
+    for (int k = SPSC_ONE; k <= MUTEX_BATCH; k++) {
+        Stage producer = { k, &ring, &locked, items, batch, 0, 1 };
+        Stage consumer = producer;
+        consumer.cpu = consumerCpu;
+        pthread_t p, c;
+        double t = nowSeconds();
+        pthread_create(&c, NULL, consumerStage, &consumer);
+        pthread_create(&p, NULL, producerStage, &producer);
+        pthread_join(p, NULL);
+        pthread_join(c, NULL);
+        double seconds = nowSeconds() - t;
+        printf("%-24s | %9.1f | %s\n", names[k], items / seconds / 1e6, consumer.inOrder ? "yes" : "NO");
+    }
+
+    spscFree(&ring);
+    lockedFree(&locked);
+    return 0;
+}
@@ -0,0 +1,149 @@
+// Scaling benchmark for ../common/task_pool.c (Chase-Lev work stealing):
+// 1. Recursive Fibonacci: fib(n-1) is spawned, fib(n-2) runs inline.
+//    Tiny tasks, so it mostly measures spawn/sync/steal overhead.
+// 2. Tree sum: sum of a perfectly balanced binary tree (built in one
+//    array), left subtree spawned, right subtree inline. Memory bound.
+// Each is run on 1, 2, 4, ... threads up to all cores (or maxThreads).
+//
+// Compile: gcc -O2 -pthread task_pool_bench.c ../common/task_pool.c ../common/ws_deque.c -o poolbench
+// Run:     ./poolbench [fibN] [treeNodes] [maxThreads]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "../common/task_pool.h"
+
+#define FIB_CUTOFF 20       // Below this fib runs without spawning
+#define TREE_GRAIN 4096     // Subtrees smaller than this are summed on one thread
+
+// ---------------- Fibonacci ----------------
+long fib(int n) {
+    return n < 2 ? n : fib(n - 1) + fib(n - 2);
+}
+
+typedef struct {
+    int n;
+    long result;
+} FibArgs;
+
+void fibTask(void* arg) {
+    FibArgs* f = arg;
+    if (f->n < FIB_CUTOFF) {
+        f->result = fib(f->n);
+        return;
+    }
+    FibArgs left = { f->n - 1, 0 }, right = { f->n - 2, 0 };
+    Task t;
+    taskInit(&t, fibTask, &left);
+    taskSpawn(&t);
+    fibTask(&right);
+    taskSync(&t);
+    f->result = left.result + right.result;
+}
+
+// ---------------- Tree sum ----------------
+struct Node {
+    int data;
+    struct Node* left;
+    struct Node* right;
+};
+
+// Node for index mid is nodes[mid], like parallel_tree_tasks.c
+struct Node* buildTree(long start, long end, struct Node* nodes) {
+    if (start > end) return NULL;
+    long mid = start + (end - start) / 2;
+    struct Node* root = &nodes[mid];
+    root->data = (int)(mid % 1000);
+    root->left = buildTree(start, mid - 1, nodes);
+    root->right = buildTree(mid + 1, end, nodes);
+    return root;
+}
+
+long long sumTree(struct Node* root) {
+    if (root == NULL) return 0;
+    return root->data + sumTree(root->left) + sumTree(root->right);
+}
+
+typedef struct {
+    struct Node* root;
+    long size;          // Nodes in this subtree (balanced, so known)
+    long long result;
+} SumArgs;
+
+void sumTask(void* arg) {
+    SumArgs* s = arg;
+    if (s->size < TREE_GRAIN) {
+        s->result = sumTree(s->root);
+        return;
+    }
+    // Balanced: the left subtree gets (size-1)/2 nodes
+    long leftSize = (s->size - 1) / 2;
+    SumArgs left = { s->root->left, leftSize, 0 };
+    SumArgs right = { s->root->right, s->size - 1 - leftSize, 0 };
+    Task t;
+    taskInit(&t, sumTask, &left);
+    taskSpawn(&t);
+    sumTask(&right);
+    taskSync(&t);
+    s->result = s->root->data + left.result + right.result;
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[]) {
+    int fibN = argc > 1 ? atoi(argv[1]) : 40;
+    long treeNodes = argc > 2 ? atol(argv[2]) : 16000000;
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int maxThreads = argc > 3 ? atoi(argv[3]) : (int)cores;
+    if (maxThreads < 1) maxThreads = 1;
+
+    struct Node* nodes = malloc(treeNodes * sizeof(struct Node));
+    struct Node* root = buildTree(0, treeNodes - 1, nodes);
+
+    double t = nowSeconds();
+    long fibExpected = fib(fibN);
+    double fibSequential = nowSeconds() - t;
+    t = nowSeconds();
+    long long sumExpected = sumTree(root);
+    double sumSequential = nowSeconds() - t;
+
+    printf("fib(%d) and sum of %ld tree nodes, %ld core(s) online\n", fibN, treeNodes, cores);
+    printf("Sequential: fib %.0f ms, tree sum %.0f ms\n\n", fibSequential * 1e3, sumSequential * 1e3);
+    printf("Threads | fib ms | speedup | steals | tree sum ms | speedup | steals | Correct\n");
+    printf("--------+--------+---------+--------+-------------+---------+--------+--------\n");
+
+    for (int threads = 1; threads <= maxThreads; threads = threads < maxThreads && threads * 2 > maxThreads ? maxThreads : threads * 2) {
+        TaskPool* pool = poolCreate(threads);
+        if (!pool) {
+            printf("Not enough memory for %d workers\n", threads);
+            break;
+        }
+
+        FibArgs f = { fibN, 0 };
+        t = nowSeconds();
+        poolRun(pool, fibTask, &f);
+        double fibTime = nowSeconds() - t;
+        long fibSteals = poolSteals(pool);
+
+        SumArgs s = { root, treeNodes, 0 };
+        t = nowSeconds();
+        poolRun(pool, sumTask, &s);
+        double sumTime = nowSeconds() - t;
+        long sumSteals = poolSteals(pool) - fibSteals;
+
+        printf("%7d | %6.0f | %7.2f | %6ld | %11.0f | %7.2f | %6ld | %s\n", threads,
+               fibTime * 1e3, fibSequential / fibTime, fibSteals,
+               sumTime * 1e3, sumSequential / sumTime, sumSteals,
+               f.result == fibExpected && s.result == sumExpected ? "yes" : "NO");
+        poolDestroy(pool);
+        if (threads == maxThreads) break;
+    }
+
+    free(nodes);
+    return 0;
+}
@@ -0,0 +1,291 @@
+// Top-K selection: the K largest of n elements without sorting all n.
+//
+// 1. Streaming (topkOffer): keep a MIN-heap of the best K seen so far.
+//    Its top is the weakest of the K, so a new element only gets in if
+//    it beats the top (replace-top). Most elements fail that one compare.
+//      O(n log K) time, O(K) memory, works on data that arrives one by
+//      one and never has to be stored.
+// 2. In place (topkSelect): introselect, like C++ nth_element.
+//    Quickselect partitions around a pivot and keeps only the side that
+//    holds position K: O(n) on average. If partitions keep coming out
+//    bad it switches to heapsort so the worst case is O(n log n).
+//      Reorders the caller's array, O(1) extra memory.
+// 3. Parallel (topkParallel): every thread streams its own chunk into
+//    its own heap, then the small heaps are merged.
+//
+// Compile: gcc -O2 -pthread topk_select.c dary_heap.c -o topk
+// Run:     ./topk [elements] [threads]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "dary_heap.h"
+
+// ---------------- Streaming top-K ----------------
+typedef struct {
+    DaryHeap heap;      // Min-heap: weakest of the current top K on top
+    size_t k;
+} TopK;
+
+void topkInit(TopK* t, size_t k, size_t elemSize, HeapCompare cmp) {
+    heapInitMin(&t->heap, elemSize, 4, cmp);
+    t->k = k;
+}
+
+void topkFree(TopK* t) {
+    heapFree(&t->heap);
+}
+
+void topkOffer(TopK* t, const void* elem) {
+    if (t->k == 0) return;
+    if (heapSize(&t->heap) < t->k)
+        heapPush(&t->heap, elem);
+    else if (t->heap.cmp(elem, heapPeek(&t->heap)) > 0)
+        heapReplaceTop(&t->heap, elem, NULL);
+}
+
+void topkOfferArray(TopK* t, const void* array, size_t n) {
+    const char* p = array;
+    for (size_t i = 0; i < n; i++)
+        topkOffer(t, p + i * t->heap.elemSize);
+}
+
+// Add everything kept by another selector (used to merge thread results)
+void topkMerge(TopK* into, const TopK* from) {
+    for (size_t i = 0; i < from->heap.count; i++)
+        topkOffer(into, from->heap.data + i * from->heap.elemSize);
+}
+
+// Writes the kept elements to out, largest first. Empties the selector.
+size_t topkResult(TopK* t, void* out) {
+    size_t m = heapSize(&t->heap);
+    char* o = out;
+    for (size_t i = m; i-- > 0; )
+        heapPop(&t->heap, o + i * t->heap.elemSize);
+    return m;
+}
+
+// ---------------- In-place introselect ----------------
+#define ELEM(i) (base + (i) * size)
+
+static void swapElems(char* a, char* b, size_t size, char* tmp) {
+    memcpy(tmp, a, size);
+    memcpy(a, b, size);
+    memcpy(b, tmp, size);
+}
+
+// Heapsort base[0..n-1] into DESCENDING order (the fallback path):
+// a min-heap whose top is swapped to the end each round
+static void heapSortDescending(char* base, size_t n, size_t size, HeapCompare cmp, char* tmp) {
+    for (size_t start = n / 2; start-- > 0; ) {
+        size_t i = start;
+        while (2 * i + 1 < n) {
+            size_t c = 2 * i + 1;
+            if (c + 1 < n && cmp(ELEM(c + 1), ELEM(c)) < 0) c++;
+            if (cmp(ELEM(c), ELEM(i)) >= 0) break;
+            swapElems(ELEM(i), ELEM(c), size, tmp);
+            i = c;
+        }
+    }
+    for (size_t end = n; end-- > 1; ) {
+        swapElems(ELEM(0), ELEM(end), size, tmp);
+        size_t i = 0;
+        while (2 * i + 1 < end) {
+            size_t c = 2 * i + 1;
+            if (c + 1 < end && cmp(ELEM(c + 1), ELEM(c)) < 0) c++;
+            if (cmp(ELEM(c), ELEM(i)) >= 0) break;
+            swapElems(ELEM(i), ELEM(c), size, tmp);
+            i = c;
+        }
+    }
+}
+
+// Reorder base so that base[0..k-1] are the k largest (in no order)
+void topkSelect(void* array, size_t n, size_t k, size_t size, HeapCompare cmp) {
+    if (k == 0 || k >= n) return;
+    char* base = array;
+    char* tmp = malloc(size);
+    char* pivot = malloc(size);
+    size_t lo = 0, hi = n - 1;      // Inclusive range that holds position k-1
+    size_t target = k - 1;
+    int depthLimit = 0;
+    for (size_t m = n; m > 1; m >>= 1) depthLimit += 2;
+
+    while (hi > lo) {
+        if (hi - lo < 16 || depthLimit-- == 0) {
+            // Small or badly split range: just sort it (largest first)
+            heapSortDescending(ELEM(lo), hi - lo + 1, size, cmp, tmp);
+            break;
+        }
+        // Median of three as the pivot
+        size_t mid = lo + (hi - lo) / 2;
+        if (cmp(ELEM(mid), ELEM(lo)) > 0) swapElems(ELEM(mid), ELEM(lo), size, tmp);
+        if (cmp(ELEM(hi), ELEM(lo)) > 0) swapElems(ELEM(hi), ELEM(lo), size, tmp);
+        if (cmp(ELEM(hi), ELEM(mid)) > 0) swapElems(ELEM(hi), ELEM(mid), size, tmp);
+        memcpy(pivot, ELEM(mid), size);
+
+        // Hoare partition, bigger elements to the left
+        size_t i = lo, j = hi;
+        while (1) {
+            while (cmp(ELEM(i), pivot) > 0) i++;
+            while (cmp(ELEM(j), pivot) < 0) j--;
+            if (i >= j) break;
+            swapElems(ELEM(i), ELEM(j), size, tmp);
+            i++;
+            j--;
+        }
+        // Now lo..j >= pivot >= j+1..hi: keep the side with target
+        if (target <= j) hi = j;
+        else lo = j + 1;
+    }
+    free(tmp);
+    free(pivot);
+}
+
+// ---------------- Parallel top-K ----------------
+typedef struct {
+    const char* start;
+    size_t count;
+    TopK selector;
+} ChunkArgs;
+
+void* chunkWorker(void* arg) {
+    ChunkArgs* c = arg;
+    topkOfferArray(&c->selector, c->start, c->count);
+    return NULL;
+}
+
+// out receives min(k, n) elements, largest first; returns how many
+size_t topkParallel(const void* array, size_t n, size_t k, size_t size,
+                    HeapCompare cmp, int threads, void* out) {
+    if (threads < 1) threads = 1;
+    pthread_t* tids = malloc(threads * sizeof(pthread_t));
+    ChunkArgs* chunks = malloc(threads * sizeof(ChunkArgs));
+    size_t per = n / threads;
+    for (int i = 0; i < threads; i++) {
+        chunks[i].start = (const char*)array + i * per * size;
+        chunks[i].count = (i == threads - 1) ? n - i * per : per;
+        topkInit(&chunks[i].selector, k, size, cmp);
+        pthread_create(&tids[i], NULL, chunkWorker, &chunks[i]);
+    }
+    TopK result;
+    topkInit(&result, k, size, cmp);
+    for (int i = 0; i < threads; i++) {
+        pthread_join(tids[i], NULL);
+        topkMerge(&result, &chunks[i].selector);    // Only K elements each
+        topkFree(&chunks[i].selector);
+    }
+    size_t m = topkResult(&result, out);
+    topkFree(&result);
+    free(tids);
+    free(chunks);
+    return m;
+}
+
+// ---------------- Demo and benchmark ----------------
+int compareInt(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+int compareIntDescending(const void* a, const void* b) {
+    return compareInt(b, a);
+}
+
+unsigned int seed = 2463534242u;
+
+unsigned int nextRandom() {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[]) {
+    size_t n = argc > 1 ? strtoul(argv[1], NULL, 10) : 50000000;
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int threads = argc > 2 ? atoi(argv[2]) : (int)(cores < 2 ? 2 : cores);
+
+    // Demo: top 3 scores
+    int scores[] = { 10, 3, 8, 9, 4, 15, 1, 12 };
+    TopK demo;
+    topkInit(&demo, 3, sizeof(int), compareInt);
+    topkOfferArray(&demo, scores, 8);
+    int best[3];
+    topkResult(&demo, best);
+    printf("Top 3 of {10, 3, 8, 9, 4, 15, 1, 12}: %d %d %d\n\n", best[0], best[1], best[2]);
+    topkFree(&demo);
+
+    int* data = malloc(n * sizeof(int));
+    int* work = malloc(n * sizeof(int));
+    if (!data || !work) {
+        printf("Not enough memory for %zu elements\n", n);
+        return 1;
+    }
+    for (size_t i = 0; i < n; i++) data[i] = (int)(nextRandom() >> 1);
+
+    printf("Top-K of %zu random ints (%ld core(s) online, parallel uses %d threads)\n", n, cores, threads);
+    printf("       K | Stream heap ms | Introselect ms | Parallel ms | Full qsort ms | Same\n");
+    printf("---------+----------------+----------------+-------------+---------------+-----\n");
+
+    size_t ks[] = { 10, 1000, 100000 };
+    for (int q = 0; q < 3; q++) {
+        size_t k = ks[q] < n ? ks[q] : n;
+        int* fromHeap = malloc(k * sizeof(int));
+        int* fromParallel = malloc(k * sizeof(int));
+
+        double t = nowSeconds();
+        TopK sel;
+        topkInit(&sel, k, sizeof(int), compareInt);
+        topkOfferArray(&sel, data, n);
+        topkResult(&sel, fromHeap);
+        topkFree(&sel);
+        double stream = nowSeconds() - t;
+
+        memcpy(work, data, n * sizeof(int));
+        t = nowSeconds();
+        topkSelect(work, n, k, sizeof(int), compareInt);
+        double select = nowSeconds() - t;
+        qsort(work, k, sizeof(int), compareIntDescending);   // Only to compare
+
+        t = nowSeconds();
+        topkParallel(data, n, k, sizeof(int), compareInt, threads, fromParallel);
+        double parallel = nowSeconds() - t;
+
+        int same = memcmp(fromHeap, work, k * sizeof(int)) == 0 &&
+                   memcmp(fromHeap, fromParallel, k * sizeof(int)) == 0;
+
+        // Sorting everything is only timed once, it does not depend on K
+        char sortText[32] = "";
+        if (q == 0) {
+            memcpy(work, data, n * sizeof(int));
+            t = nowSeconds();
+            qsort(work, n, sizeof(int), compareIntDescending);
+            snprintf(sortText, sizeof(sortText), "%.0f", (nowSeconds() - t) * 1e3);
+            if (memcmp(work, fromHeap, k * sizeof(int)) != 0) same = 0;
+        }
+        printf("%8zu | %14.0f | %14.0f | %11.0f | %13s | %s\n", k,
+               stream * 1e3, select * 1e3, parallel * 1e3, sortText, same ? "yes" : "NO");
+        free(fromHeap);
+        free(fromParallel);
+    }
+
+    // Adversarial input for quickselect: already sorted, many duplicates
+    for (size_t i = 0; i < n; i++) work[i] = (int)(i % 1000);
+    double t = nowSeconds();
+    topkSelect(work, n, 1000, sizeof(int), compareInt);
+    printf("\nIntroselect on %zu values with only 1000 distinct: %.0f ms\n", n, (nowSeconds() - t) * 1e3);
+
+    free(data);
+    free(work);
+    return 0;
+}
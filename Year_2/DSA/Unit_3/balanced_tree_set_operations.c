@@ -0,0 +1,888 @@
+/*
+ * SET OPERATIONS ON BALANCED TREES (JOIN-BASED)
+ * =============================================
+ *
+ * Problem:
+ * We have two AVL (or Red-Black) trees and want their
+ * - UNION         (keys in either tree)
+ * - INTERSECTION  (keys in both trees)
+ * - DIFFERENCE    (keys in the first tree but not in the second)
+ *
+ * Simple way: insert the smaller tree's keys one at a time into the
+ * bigger tree. That is m * O(log n) and cannot use more than one core.
+ *
+ * Better way: everything is built from ONE balancing primitive, JOIN.
+ *
+ *   join(L, k, R): all keys in L < k < all keys in R
+ *                  returns one balanced tree with L, k and R
+ *
+ * If L and R have very different heights, join walks down the right
+ * spine of the taller tree until it finds a subtree of about the same
+ * height as the short one, hangs k there, and rebalances on the way up.
+ * Cost: O(difference in heights).
+ *
+ * With join we get SPLIT:
+ *   split(T, k) -> (keys < k, was k present?, keys > k)
+ *
+ * And then the set operations are all "divide and conquer":
+ *
+ *   union(T1, T2):
+ *       take the root k of T2 and split T1 around k
+ *       union the two left parts, union the two right parts
+ *       join(leftResult, k, rightResult)
+ *
+ * The two recursive calls touch different nodes, so they can run on
+ * different cores at the same time (fork-join).
+ *
+ * Cost: O(m log(n/m + 1)) for trees of size m <= n. When m is small
+ * this is like m inserts, when m = n it is linear like a merge.
+ *
+ * Only join knows about AVL heights or Red-Black colors. Split, union,
+ * intersection and difference are the same code for both trees.
+ *
+ * All operations here REUSE the nodes of their input trees (no copying),
+ * so the input trees are consumed. Intersection and difference drop
+ * whole subtrees in their base cases; freeing those node by node would
+ * cost O(n) and hide the bound above, so they are only put on a
+ * "discarded" list (O(1) each) and freed after the operation.
+ *
+ * Compile: gcc -O2 -pthread balanced_tree_set_operations.c -o setops
+ * Run:     ./setops [bigTreeSize] [threads]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+// Which balancing rules a tree follows
+enum TreeType {
+    AVL,
+    RED_BLACK
+};
+
+enum Color {
+    RED,
+    BLACK
+};
+
+enum SetOp {
+    UNION,
+    INTERSECTION,
+    DIFFERENCE
+};
+
+// One node type serves both trees
+struct Node {
+    int data;
+    struct Node* left;
+    struct Node* right;
+    int rank;           // AVL: height.  Red-Black: black height
+    enum Color color;   // Red-Black only
+};
+
+/*
+ * BASIC HELPERS
+ * -------------
+ */
+struct Node* createNode(int value) {
+    struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    newNode->data = value;
+    newNode->left = NULL;
+    newNode->right = NULL;
+    newNode->rank = 1;
+    newNode->color = RED;
+    return newNode;
+}
+
+int rankOf(struct Node* node) {
+    if (node == NULL) {
+        return 0;
+    }
+    return node->rank;
+}
+
+int max(int a, int b) {
+    return (a > b) ? a : b;
+}
+
+int isRed(struct Node* node) {
+    return node != NULL && node->color == RED;
+}
+
+/*
+ * Recompute rank from the children
+ * AVL:       height = 1 + max(height(left), height(right))
+ * Red-Black: black height = black height(left) + (1 if this node is BLACK)
+ */
+void update(enum TreeType type, struct Node* node) {
+    if (type == AVL) {
+        node->rank = 1 + max(rankOf(node->left), rankOf(node->right));
+    }
+    else {
+        node->rank = rankOf(node->left) + (node->color == BLACK ? 1 : 0);
+    }
+}
+
+// Hang L and R under 'mid' and fix its rank
+struct Node* makeNode(enum TreeType type, struct Node* L, struct Node* mid, struct Node* R) {
+    mid->left = L;
+    mid->right = R;
+    update(type, mid);
+    return mid;
+}
+
+/*
+ * ROTATIONS (same pictures as avl_tree.c)
+ * ---------
+ */
+struct Node* rotateLeft(enum TreeType type, struct Node* z) {
+    struct Node* y = z->right;
+    z->right = y->left;
+    y->left = z;
+    update(type, z);
+    update(type, y);
+    return y;
+}
+
+struct Node* rotateRight(enum TreeType type, struct Node* z) {
+    struct Node* y = z->left;
+    z->left = y->right;
+    y->right = z;
+    update(type, z);
+    update(type, y);
+    return y;
+}
+
+/*
+ * AVL JOIN
+ * --------
+ * If TL is much taller than TR, walk down TL's right spine until the
+ * subtree c has height <= height(TR) + 1. Put (c, k, TR) together there.
+ * On the way back up, one single or double rotation fixes any node whose
+ * right side became 2 taller than its left side.
+ */
+struct Node* joinRightAVL(struct Node* TL, struct Node* mid, struct Node* TR) {
+    struct Node* l = TL->left;
+    struct Node* c = TL->right;
+
+    if (rankOf(c) <= rankOf(TR) + 1) {
+        struct Node* T1 = makeNode(AVL, c, mid, TR);
+        if (rankOf(T1) <= rankOf(l) + 1) {
+            return makeNode(AVL, l, TL, T1);
+        }
+        // Right-Left case
+        return rotateLeft(AVL, makeNode(AVL, l, TL, rotateRight(AVL, T1)));
+    }
+
+    struct Node* T1 = joinRightAVL(c, mid, TR);
+    struct Node* T2 = makeNode(AVL, l, TL, T1);
+    if (rankOf(T1) <= rankOf(l) + 1) {
+        return T2;
+    }
+    // Right-Right case
+    return rotateLeft(AVL, T2);
+}
+
+// Mirror image of joinRightAVL
+struct Node* joinLeftAVL(struct Node* TL, struct Node* mid, struct Node* TR) {
+    struct Node* c = TR->left;
+    struct Node* r = TR->right;
+
+    if (rankOf(c) <= rankOf(TL) + 1) {
+        struct Node* T1 = makeNode(AVL, TL, mid, c);
+        if (rankOf(T1) <= rankOf(r) + 1) {
+            return makeNode(AVL, T1, TR, r);
+        }
+        return rotateRight(AVL, makeNode(AVL, rotateLeft(AVL, T1), TR, r));
+    }
+
+    struct Node* T1 = joinLeftAVL(TL, mid, c);
+    struct Node* T2 = makeNode(AVL, T1, TR, r);
+    if (rankOf(T1) <= rankOf(r) + 1) {
+        return T2;
+    }
+    return rotateRight(AVL, T2);
+}
+
+struct Node* joinAVL(struct Node* TL, struct Node* mid, struct Node* TR) {
+    if (rankOf(TL) > rankOf(TR) + 1) {
+        return joinRightAVL(TL, mid, TR);
+    }
+    if (rankOf(TR) > rankOf(TL) + 1) {
+        return joinLeftAVL(TL, mid, TR);
+    }
+    return makeNode(AVL, TL, mid, TR);
+}
+
+/*
+ * RED-BLACK JOIN
+ * --------------
+ * Same idea, but we compare BLACK heights.
+ * Walk down TL's right spine to a BLACK node with the same black height
+ * as TR and hang a new RED node (that subtree, k, TR) there.
+ * Black heights are unchanged; the only possible problem is RED-RED on
+ * the right spine, fixed by one left rotation + recoloring (the same
+ * fix as Case 3 in red_black_tree.c's fixInsert).
+ */
+struct Node* joinRightRB(struct Node* T, struct Node* mid, struct Node* TR) {
+    if (!isRed(T) && rankOf(T) == rankOf(TR)) {
+        mid->color = RED;
+        return makeNode(RED_BLACK, T, mid, TR);
+    }
+
+    T->right = joinRightRB(T->right, mid, TR);
+    update(RED_BLACK, T);
+
+    if (T->color == BLACK && isRed(T->right) && isRed(T->right->right)) {
+        T->right->right->color = BLACK;
+        update(RED_BLACK, T->right->right);
+        return rotateLeft(RED_BLACK, T);
+    }
+    return T;
+}
+
+// Mirror image of joinRightRB
+struct Node* joinLeftRB(struct Node* TL, struct Node* mid, struct Node* T) {
+    if (!isRed(T) && rankOf(T) == rankOf(TL)) {
+        mid->color = RED;
+        return makeNode(RED_BLACK, TL, mid, T);
+    }
+
+    T->left = joinLeftRB(TL, mid, T->left);
+    update(RED_BLACK, T);
+
+    if (T->color == BLACK && isRed(T->left) && isRed(T->left->left)) {
+        T->left->left->color = BLACK;
+        update(RED_BLACK, T->left->left);
+        return rotateRight(RED_BLACK, T);
+    }
+    return T;
+}
+
+struct Node* joinRB(struct Node* TL, struct Node* mid, struct Node* TR) {
+    // A red root can always be made black (every path gains one black node)
+    if (isRed(TL)) {
+        TL->color = BLACK;
+        update(RED_BLACK, TL);
+    }
+    if (isRed(TR)) {
+        TR->color = BLACK;
+        update(RED_BLACK, TR);
+    }
+
+    struct Node* T;
+    if (rankOf(TL) > rankOf(TR)) {
+        T = joinRightRB(TL, mid, TR);
+    }
+    else if (rankOf(TR) > rankOf(TL)) {
+        T = joinLeftRB(TL, mid, TR);
+    }
+    else {
+        mid->color = RED;
+        T = makeNode(RED_BLACK, TL, mid, TR);
+    }
+
+    // Root may be red; that is fine inside the algorithm, the public
+    // functions below color the final root BLACK
+    return T;
+}
+
+struct Node* join(enum TreeType type, struct Node* TL, struct Node* mid, struct Node* TR) {
+    if (type == AVL) {
+        return joinAVL(TL, mid, TR);
+    }
+    return joinRB(TL, mid, TR);
+}
+
+/*
+ * SPLIT
+ * -----
+ * Split T around key k into *L (keys < k) and *R (keys > k).
+ * Returns the node holding k (detached from the tree) or NULL.
+ *
+ * Going down one side, the other side is joined back with the current
+ * node as the middle key: O(log n) in total.
+ */
+struct Node* split(enum TreeType type, struct Node* T, int k, struct Node** L, struct Node** R) {
+    if (T == NULL) {
+        *L = NULL;
+        *R = NULL;
+        return NULL;
+    }
+
+    struct Node* left = T->left;
+    struct Node* right = T->right;
+
+    if (k < T->data) {
+        struct Node* middle;
+        struct Node* found = split(type, left, k, L, &middle);
+        *R = join(type, middle, T, right);
+        return found;
+    }
+    if (k > T->data) {
+        struct Node* middle;
+        struct Node* found = split(type, right, k, &middle, R);
+        *L = join(type, left, T, middle);
+        return found;
+    }
+
+    *L = left;
+    *R = right;
+    return T;
+}
+
+/*
+ * JOIN WITHOUT A MIDDLE KEY
+ * -------------------------
+ * Take the largest node out of L and use it as the middle key.
+ */
+struct Node* splitLast(enum TreeType type, struct Node* T, struct Node** last) {
+    if (T->right == NULL) {
+        *last = T;
+        return T->left;
+    }
+    struct Node* rest = splitLast(type, T->right, last);
+    return join(type, T->left, T, rest);
+}
+
+struct Node* join2(enum TreeType type, struct Node* L, struct Node* R) {
+    if (L == NULL) {
+        return R;
+    }
+    struct Node* last;
+    struct Node* rest = splitLast(type, L, &last);
+    return join(type, rest, last, R);
+}
+
+void freeTree(struct Node* root) {
+    if (root == NULL) {
+        return;
+    }
+    freeTree(root->left);
+    freeTree(root->right);
+    free(root);
+}
+
+/*
+ * DISCARDED SUBTREES
+ * ------------------
+ * Roots of subtrees an operation no longer needs. Every thread of an
+ * operation has its own list, so adding needs no lock; a forking thread
+ * takes over its helper's list after pthread_join.
+ */
+struct Discarded {
+    struct Node** roots;
+    int count;
+    int capacity;
+};
+
+void discardTree(struct Discarded* d, struct Node* root) {
+    if (root == NULL) {
+        return;
+    }
+    if (d->count == d->capacity) {
+        int capacity = d->capacity ? 2 * d->capacity : 64;
+        struct Node** roots = (struct Node**)realloc(d->roots, capacity * sizeof(struct Node*));
+        if (roots == NULL) {
+            freeTree(root);  // Out of memory: free it now instead
+            return;
+        }
+        d->roots = roots;
+        d->capacity = capacity;
+    }
+    d->roots[d->count++] = root;
+}
+
+void freeDiscarded(struct Discarded* d) {
+    for (int i = 0; i < d->count; i++) {
+        freeTree(d->roots[i]);
+    }
+    free(d->roots);
+    d->roots = NULL;
+    d->count = d->capacity = 0;
+}
+
+/*
+ * UNION / INTERSECTION / DIFFERENCE
+ * ---------------------------------
+ * One recursive function handles all three; only the base cases and the
+ * final combine step differ.
+ *
+ * depth > 0 means "run the left half on a new thread". Each level doubles
+ * the number of threads, so depth = log2(cores) (+ a little extra to
+ * even out uneven halves) keeps every core busy.
+ */
+struct SetTask {
+    enum TreeType type;
+    enum SetOp op;
+    struct Node* T1;
+    struct Node* T2;
+    int depth;
+    struct Node* result;
+    struct Discarded discarded;
+};
+
+struct Node* setOperation(enum TreeType type, enum SetOp op,
+                          struct Node* T1, struct Node* T2, int depth,
+                          struct Discarded* discarded);
+
+void* setTaskThread(void* arg) {
+    struct SetTask* task = (struct SetTask*)arg;
+    task->result = setOperation(task->type, task->op, task->T1, task->T2, task->depth,
+                                &task->discarded);
+    return NULL;
+}
+
+struct Node* setOperation(enum TreeType type, enum SetOp op,
+                          struct Node* T1, struct Node* T2, int depth,
+                          struct Discarded* discarded) {
+    // Base cases
+    if (T1 == NULL || T2 == NULL) {
+        if (op == UNION) {
+            return T1 != NULL ? T1 : T2;
+        }
+        if (op == DIFFERENCE) {
+            discardTree(discarded, T2);
+            return T1;
+        }
+        // INTERSECTION with an empty tree is empty. The unused part of the
+        // big tree is discarded, not freed: freeing it is O(its size).
+        discardTree(discarded, T1);
+        discardTree(discarded, T2);
+        return NULL;
+    }
+
+    // Take T2 apart at its root and split T1 around the root's key
+    struct Node* L2 = T2->left;
+    struct Node* R2 = T2->right;
+    struct Node* L1;
+    struct Node* R1;
+    struct Node* found = split(type, T1, T2->data, &L1, &R1);
+
+    // Solve the two halves (in parallel near the top of the recursion)
+    struct Node* left;
+    struct Node* right;
+    if (depth > 0) {
+        struct SetTask task = { type, op, L1, L2, depth - 1, NULL, { NULL, 0, 0 } };
+        pthread_t helper;
+        pthread_create(&helper, NULL, setTaskThread, &task);
+        right = setOperation(type, op, R1, R2, depth - 1, discarded);
+        pthread_join(helper, NULL);
+        left = task.result;
+        for (int i = 0; i < task.discarded.count; i++) {
+            discardTree(discarded, task.discarded.roots[i]);
+        }
+        free(task.discarded.roots);
+    }
+    else {
+        left = setOperation(type, op, L1, L2, 0, discarded);
+        right = setOperation(type, op, R1, R2, 0, discarded);
+    }
+
+    // Combine
+    if (op == UNION || (op == INTERSECTION && found != NULL)) {
+        free(found);  // Key kept once, using T2's node
+        return join(type, left, T2, right);
+    }
+
+    free(found);
+    free(T2);
+    return join2(type, left, right);
+}
+
+// Public entry points: color the final root BLACK for Red-Black trees
+struct Node* finishRoot(enum TreeType type, struct Node* root) {
+    if (type == RED_BLACK && isRed(root)) {
+        root->color = BLACK;
+        update(RED_BLACK, root);
+    }
+    return root;
+}
+
+// These free the discarded subtrees right away; the benchmark calls
+// setOperation itself so it can free them after the timer stops.
+struct Node* treeSetOperation(enum TreeType type, enum SetOp op,
+                              struct Node* T1, struct Node* T2, int depth) {
+    struct Discarded discarded = { NULL, 0, 0 };
+    struct Node* result = finishRoot(type, setOperation(type, op, T1, T2, depth, &discarded));
+    freeDiscarded(&discarded);
+    return result;
+}
+
+struct Node* treeUnion(enum TreeType type, struct Node* T1, struct Node* T2, int depth) {
+    return treeSetOperation(type, UNION, T1, T2, depth);
+}
+
+struct Node* treeIntersection(enum TreeType type, struct Node* T1, struct Node* T2, int depth) {
+    return treeSetOperation(type, INTERSECTION, T1, T2, depth);
+}
+
+struct Node* treeDifference(enum TreeType type, struct Node* T1, struct Node* T2, int depth) {
+    return treeSetOperation(type, DIFFERENCE, T1, T2, depth);
+}
+
+/*
+ * BUILD A TREE FROM A SORTED ARRAY
+ * --------------------------------
+ * Like sortedArrayToBST in bst_applications.c, but the two halves are
+ * glued together with join so the result follows the tree's rules.
+ */
+struct Node* buildFromSorted(enum TreeType type, int arr[], int start, int end) {
+    if (start > end) {
+        return NULL;
+    }
+    int mid = start + (end - start) / 2;
+    struct Node* L = buildFromSorted(type, arr, start, mid - 1);
+    struct Node* R = buildFromSorted(type, arr, mid + 1, end);
+    return join(type, L, createNode(arr[mid]), R);
+}
+
+struct Node* buildTree(enum TreeType type, int arr[], int n) {
+    return finishRoot(type, buildFromSorted(type, arr, 0, n - 1));
+}
+
+/*
+ * ONE-AT-A-TIME INSERT (THE SLOW BASELINE)
+ * ----------------------------------------
+ * AVL: the same insert as avl_tree.c
+ * Red-Black: recursive insert that fixes RED-RED on the way back up
+ * (a black node with a red child and red grandchild becomes a red node
+ *  with two black children - all four shapes end up the same)
+ */
+struct Node* insertAVL(struct Node* node, int value) {
+    if (node == NULL) {
+        return createNode(value);
+    }
+    if (value < node->data) {
+        node->left = insertAVL(node->left, value);
+    }
+    else if (value > node->data) {
+        node->right = insertAVL(node->right, value);
+    }
+    else {
+        return node;
+    }
+
+    update(AVL, node);
+    int balance = rankOf(node->left) - rankOf(node->right);
+
+    if (balance > 1 && value < node->left->data) {
+        return rotateRight(AVL, node);
+    }
+    if (balance < -1 && value > node->right->data) {
+        return rotateLeft(AVL, node);
+    }
+    if (balance > 1 && value > node->left->data) {
+        node->left = rotateLeft(AVL, node->left);
+        return rotateRight(AVL, node);
+    }
+    if (balance < -1 && value < node->right->data) {
+        node->right = rotateRight(AVL, node->right);
+        return rotateLeft(AVL, node);
+    }
+    return node;
+}
+
+// Rebuild x < y < z as red y with black children x and z
+struct Node* balanceShape(struct Node* x, struct Node* y, struct Node* z,
+                          struct Node* a, struct Node* b, struct Node* c, struct Node* d) {
+    x->left = a;
+    x->right = b;
+    z->left = c;
+    z->right = d;
+    x->color = BLACK;
+    z->color = BLACK;
+    update(RED_BLACK, x);
+    update(RED_BLACK, z);
+    y->color = RED;
+    return makeNode(RED_BLACK, x, y, z);
+}
+
+struct Node* balanceRB(struct Node* g) {
+    if (g->color != BLACK) {
+        return g;
+    }
+    struct Node* p = g->left;
+    if (isRed(p) && isRed(p->left)) {
+        struct Node* c = p->left;
+        return balanceShape(c, p, g, c->left, c->right, p->right, g->right);
+    }
+    if (isRed(p) && isRed(p->right)) {
+        struct Node* c = p->right;
+        return balanceShape(p, c, g, p->left, c->left, c->right, g->right);
+    }
+    p = g->right;
+    if (isRed(p) && isRed(p->left)) {
+        struct Node* c = p->left;
+        return balanceShape(g, c, p, g->left, c->left, c->right, p->right);
+    }
+    if (isRed(p) && isRed(p->right)) {
+        struct Node* c = p->right;
+        return balanceShape(g, p, c, g->left, p->left, c->left, c->right);
+    }
+    return g;
+}
+
+struct Node* insertRBUtil(struct Node* node, int value) {
+    if (node == NULL) {
+        struct Node* newNode = createNode(value);
+        newNode->rank = 0;  // Red leaf: black height 0
+        return newNode;
+    }
+    if (value < node->data) {
+        node->left = insertRBUtil(node->left, value);
+    }
+    else if (value > node->data) {
+        node->right = insertRBUtil(node->right, value);
+    }
+    else {
+        return node;
+    }
+    return balanceRB(node);
+}
+
+struct Node* insertKey(enum TreeType type, struct Node* root, int value) {
+    if (type == AVL) {
+        return insertAVL(root, value);
+    }
+    return finishRoot(RED_BLACK, insertRBUtil(root, value));
+}
+
+/*
+ * CHECKING RESULTS
+ * ----------------
+ */
+
+// Returns rank if the subtree follows the rules, -1 otherwise
+int checkRules(enum TreeType type, struct Node* node) {
+    if (node == NULL) {
+        return 0;
+    }
+    int l = checkRules(type, node->left);
+    int r = checkRules(type, node->right);
+    if (l < 0 || r < 0) {
+        return -1;
+    }
+
+    if (type == AVL) {
+        if (l - r > 1 || r - l > 1 || node->rank != 1 + max(l, r)) {
+            return -1;
+        }
+    }
+    else {
+        if (l != r || node->rank != l + (node->color == BLACK ? 1 : 0)) {
+            return -1;
+        }
+        if (isRed(node) && (isRed(node->left) || isRed(node->right))) {
+            return -1;
+        }
+    }
+    return node->rank;
+}
+
+// Inorder into an array, returns the new count
+int toArray(struct Node* node, int out[], int count) {
+    if (node == NULL) {
+        return count;
+    }
+    count = toArray(node->left, out, count);
+    out[count++] = node->data;
+    return toArray(node->right, out, count);
+}
+
+// Expected answer by merging two sorted arrays
+int mergeExpected(enum SetOp op, int a[], int n, int b[], int m, int out[]) {
+    int i = 0, j = 0, count = 0;
+    while (i < n || j < m) {
+        if (j == m || (i < n && a[i] < b[j])) {
+            if (op != INTERSECTION) out[count++] = a[i];
+            i++;
+        }
+        else if (i == n || b[j] < a[i]) {
+            if (op == UNION) out[count++] = b[j];
+            j++;
+        }
+        else {
+            if (op != DIFFERENCE) out[count++] = a[i];
+            i++;
+            j++;
+        }
+    }
+    return count;
+}
+
+void printTree(struct Node* root) {
+    int values[64];
+    int count = toArray(root, values, 0);
+    for (int i = 0; i < count; i++) {
+        printf("%d ", values[i]);
+    }
+}
+
+/*
+ * BENCHMARK HELPERS
+ * -----------------
+ */
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int compareInts(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// n distinct sorted random keys from [0, range)
+int* randomSortedKeys(int n, int range, unsigned int seed, int* outCount) {
+    int* keys = (int*)malloc(n * sizeof(int));
+    srand(seed);
+    for (int i = 0; i < n; i++) {
+        keys[i] = (int)(((long long)rand() * (RAND_MAX + 1LL) + rand()) % range);
+    }
+    qsort(keys, n, sizeof(int), compareInts);
+
+    int count = 0;
+    for (int i = 0; i < n; i++) {
+        if (count == 0 || keys[i] != keys[count - 1]) {
+            keys[count++] = keys[i];
+        }
+    }
+    *outCount = count;
+    return keys;
+}
+
+const char* opName(enum SetOp op) {
+    return op == UNION ? "union" : (op == INTERSECTION ? "intersection" : "difference");
+}
+
+// Time one set operation and check it. The trees are built and the
+// discarded subtrees freed outside the timer.
+double timeSetOp(enum TreeType type, enum SetOp op, int a[], int n, int b[], int m,
+                 int depth, int expected[], int* ok) {
+    struct Node* T1 = buildTree(type, a, n);
+    struct Node* T2 = buildTree(type, b, m);
+    struct Discarded discarded = { NULL, 0, 0 };
+
+    double start = nowSeconds();
+    struct Node* result = finishRoot(type, setOperation(type, op, T1, T2, depth, &discarded));
+    double elapsed = nowSeconds() - start;
+    freeDiscarded(&discarded);
+
+    int expectedCount = mergeExpected(op, a, n, b, m, expected);
+    int* got = (int*)malloc((n + m + 1) * sizeof(int));
+    int count = toArray(result, got, 0);
+    *ok = checkRules(type, result) >= 0 && count == expectedCount;
+    for (int i = 0; *ok && i < count; i++) {
+        if (got[i] != expected[i]) {
+            *ok = 0;
+        }
+    }
+
+    free(got);
+    freeTree(result);
+    return elapsed;
+}
+
+void runBenchmark(int bigSize, int threads) {
+    int depth = 0;
+    while ((1 << depth) < threads) {
+        depth++;
+    }
+    int parallelDepth = threads > 1 ? depth + 2 : 0;
+
+    int n;
+    int* a = randomSortedKeys(bigSize, bigSize * 4, 1, &n);
+    int* expected = (int*)malloc(2 * (size_t)bigSize * sizeof(int));
+    int smallSizes[] = {1000, 10000, 100000, bigSize};
+
+    printf("Big tree: %d keys, %d threads (fork depth %d)\n\n", n, threads, parallelDepth);
+
+    for (int t = 0; t < 2; t++) {
+        enum TreeType type = (t == 0) ? AVL : RED_BLACK;
+        printf("%s\n", type == AVL ? "AVL TREE" : "RED-BLACK TREE");
+        printf("    m     | insert loop | union 1 thr | union par | intersect par | difference par | ok\n");
+        printf("----------+-------------+-------------+-----------+---------------+----------------+---\n");
+
+        for (int s = 0; s < 4; s++) {
+            if (smallSizes[s] > bigSize) {
+                continue;
+            }
+            int m;
+            int* b = randomSortedKeys(smallSizes[s], bigSize * 4, 100 + s, &m);
+            int allOk = 1;
+            int ok;
+
+            // Baseline: insert b's keys one at a time into a tree of a
+            struct Node* T1 = buildTree(type, a, n);
+            double start = nowSeconds();
+            for (int i = 0; i < m; i++) {
+                T1 = insertKey(type, T1, b[i]);
+            }
+            double insertTime = nowSeconds() - start;
+            allOk &= checkRules(type, T1) >= 0;
+            freeTree(T1);
+
+            double unionSeq = timeSetOp(type, UNION, a, n, b, m, 0, expected, &ok);
+            allOk &= ok;
+            double unionPar = timeSetOp(type, UNION, a, n, b, m, parallelDepth, expected, &ok);
+            allOk &= ok;
+            double interPar = timeSetOp(type, INTERSECTION, a, n, b, m, parallelDepth, expected, &ok);
+            allOk &= ok;
+            double diffPar = timeSetOp(type, DIFFERENCE, a, n, b, m, parallelDepth, expected, &ok);
+            allOk &= ok;
+
+            printf(" %8d | %8.2f ms | %8.2f ms | %6.2f ms | %10.2f ms | %11.2f ms | %s\n",
+                   m, insertTime * 1e3, unionSeq * 1e3, unionPar * 1e3,
+                   interPar * 1e3, diffPar * 1e3, allOk ? "yes" : "NO");
+            free(b);
+        }
+        printf("\n");
+    }
+
+    free(expected);
+    free(a);
+}
+
+/*
+ * MAIN FUNCTION - DEMO + BENCHMARK
+ * --------------------------------
+ */
+int main(int argc, char* argv[]) {
+    int bigSize = argc > 1 ? atoi(argv[1]) : 1000000;
+    int threads = argc > 2 ? atoi(argv[2]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+
+    printf("=== JOIN-BASED SET OPERATIONS ON AVL AND RED-BLACK TREES ===\n\n");
+
+    int a[] = {10, 20, 30, 40, 50, 60, 70};
+    int b[] = {15, 30, 45, 60, 75};
+
+    printf("A = {10, 20, 30, 40, 50, 60, 70}\n");
+    printf("B = {15, 30, 45, 60, 75}\n\n");
+
+    for (int t = 0; t < 2; t++) {
+        enum TreeType type = (t == 0) ? AVL : RED_BLACK;
+        printf("%s:\n", type == AVL ? "AVL" : "Red-Black");
+
+        for (int o = 0; o < 3; o++) {
+            enum SetOp op = (enum SetOp)o;
+            struct Node* result = treeSetOperation(type, op, buildTree(type, a, 7),
+                                                   buildTree(type, b, 5), 1);
+            printf("   %-12s: ", opName(op));
+            printTree(result);
+            printf("  (valid %s: %s)\n", type == AVL ? "AVL" : "RB",
+                   checkRules(type, result) >= 0 ? "Yes" : "No");
+            freeTree(result);
+        }
+        printf("\n");
+    }
+
+    printf("Benchmark: union/intersection/difference vs inserting m keys one by one\n");
+    runBenchmark(bigSize, threads);
+
+    return 0;
+}
@@ -4,12 +4,16 @@
  * 
  * This file demonstrates practical applications of BST:
  * 1. Checking if a tree is a valid BST
- * 2. Finding kth smallest/largest element
- * 3. Range queries (find all elements in a range)
- * 4. Lowest Common Ancestor (LCA)
- * 5. Converting sorted array to BST
- * 6. Finding floor and ceiling values
- * 7. Checking if two BSTs are identical
+ * 2. Finding kth smallest element
+ * 3. Finding kth largest element
+ * 4. Range queries (find all elements in a range)
+ * 5. Lowest Common Ancestor (LCA)
+ * 6. Converting sorted array to BST
+ * 7. Finding floor value
+ * 8. Finding ceiling value
+ * 9. Checking if two BSTs are identical
+ * 10. Counting nodes in a range
+ * 11. Range iterator (seek + next) for reading a range page by page
  */
 
 #include <stdio.h>
@@ -364,6 +368,107 @@ int countInRange(struct Node* root, int low, int high) {
     return count;
 }
 
+/*
+ * APPLICATION 11: RANGE ITERATOR (SEEK + NEXT, NO RECURSION)
+ * ----------------------------------------------------------
+ * rangeQuery above prints everything at once. Often we want to:
+ * - stop early (e.g. "give me the first 10 values >= 25")
+ * - read results page by page
+ * - use the values instead of printing them
+ *
+ * Idea: keep our own stack of nodes instead of the recursion stack.
+ * The stack holds the nodes we have not visited yet,
+ * with the NEXT smallest value always on top.
+ *
+ * seek(low):  walk from root towards low (O(height))
+ *             - node >= low: push it, go left (smaller candidates)
+ *             - node <  low: skip it, go right
+ * next():     pop the top node, then push the leftmost path of
+ *             its right subtree (O(1) on average per value)
+ *
+ * So reading one page of k values costs O(height + k).
+ *
+ * Example: For BST [50, 30, 70, 20, 40, 60, 80]
+ * seek(25) pushes 50, 30  -> next() gives 30, 40, 50, 60 ...
+ */
+struct RangeIterator {
+    struct Node** stack;  // Nodes still to visit (grows when needed)
+    int top;              // Number of nodes on the stack
+    int capacity;         // Allocated size of stack
+    int high;             // Stop once values go above this
+};
+
+void iteratorInit(struct RangeIterator* it) {
+    it->capacity = 64;
+    it->stack = (struct Node**)malloc(it->capacity * sizeof(struct Node*));
+    it->top = 0;
+    it->high = INT_MAX;
+}
+
+void iteratorFree(struct RangeIterator* it) {
+    free(it->stack);
+    it->stack = NULL;
+    it->top = 0;
+    it->capacity = 0;
+}
+
+// Push with doubling, so even a skewed tree cannot overflow the stack
+void iteratorPush(struct RangeIterator* it, struct Node* node) {
+    if (it->top == it->capacity) {
+        it->capacity *= 2;
+        it->stack = (struct Node**)realloc(it->stack, it->capacity * sizeof(struct Node*));
+    }
+    it->stack[it->top++] = node;
+}
+
+// Position the iterator on the smallest value >= low
+void iteratorSeek(struct RangeIterator* it, struct Node* root, int low, int high) {
+    it->top = 0;
+    it->high = high;
+
+    while (root != NULL) {
+        if (root->data >= low) {
+            iteratorPush(it, root);  // Candidate, but smaller ones may be on the left
+            root = root->left;
+        }
+        else {
+            root = root->right;      // Too small, so its whole left side is too small
+        }
+    }
+}
+
+// Get the next value in range. Returns 1 if a value was produced, 0 when done.
+int iteratorNext(struct RangeIterator* it, int* value) {
+    if (it->top == 0) {
+        return 0;
+    }
+
+    struct Node* node = it->stack[--it->top];
+    if (node->data > it->high) {
+        it->top = 0;  // Past the end of the range, nothing more to give
+        return 0;
+    }
+
+    // Next smallest values are on the leftmost path of the right subtree
+    struct Node* current = node->right;
+    while (current != NULL) {
+        iteratorPush(it, current);
+        current = current->left;
+    }
+
+    *value = node->data;
+    return 1;
+}
+
+// Fill buffer with up to maxCount values. Returns how many were written.
+int iteratorNextBatch(struct RangeIterator* it, int buffer[], int maxCount) {
+    int count = 0;
+    while (count < maxCount && iteratorNext(it, &buffer[count])) {
+        count++;
+    }
+    return count;
+}
+
 // Helper function for display
 void inorder(struct Node* root) {
     if (root != NULL) {
@@ -436,7 +541,30 @@ int main() {
     // Application 10: Count in range
     printf("\n\n10. Count of nodes in range [25, 65]: %d", 
            countInRange(root, 25, 65));
-    
+
+    // Application 11: Range iterator, read page by page
+    printf("\n\n11. Range [25, 75] read in pages of 2 using the iterator:");
+    struct RangeIterator it;
+    iteratorInit(&it);
+    iteratorSeek(&it, root, 25, 75);
+    int page[2];
+    int pageNumber = 1;
+    int got;
+    while ((got = iteratorNextBatch(&it, page, 2)) > 0) {
+        printf("\n    Page %d: ", pageNumber++);
+        for (int i = 0; i < got; i++) {
+            printf("%d ", page[i]);
+        }
+    }
+
+    // Stop after the first value, the rest of the tree is never touched
+    int first;
+    iteratorSeek(&it, root, 45, INT_MAX);
+    if (iteratorNext(&it, &first)) {
+        printf("\n    First value >= 45: %d", first);
+    }
+    iteratorFree(&it);
+
     printf("\n\n");
     return 0;
 }
@@ -0,0 +1,877 @@
+/*
+ * BST PRACTICE PROBLEMS - ITERATIVE (STACK-SAFE) VERSIONS
+ * =======================================================
+ *
+ * The solutions in bst_practice_problems.c are recursive. Every recursive
+ * call uses some of the program's call stack (usually 8 MB). A skewed tree
+ * (insert 1, 2, 3, ... in order) has height n, so with a few hundred
+ * thousand nodes the recursion runs out of stack and the program crashes.
+ *
+ * Fix: do the same work with OUR OWN stack/queue on the heap.
+ * - It grows with realloc, so only memory limits the tree size
+ * - Each entry is a few bytes instead of a whole call frame
+ *
+ * Problems covered (same numbers as bst_practice_problems.c):
+ * 1.  Height                    7.  Distance between two nodes
+ * 2.  Is balanced               8.  Identical trees (paired stack)
+ * 3.  Mirror                    9.  Count leaves
+ * 4.  Diameter                  10. Sum of all nodes
+ * 5.  All root-to-leaf paths    11. Level order (growable queue)
+ * 6.  Greater Sum Tree          12. Maximum value
+ *
+ * Bonus: treeStats computes height, diameter AND balance in ONE pass.
+ * (The recursive isBalanced calls findHeight at every node: O(n log n)
+ *  on a balanced tree and O(n^2) on a skewed one.)
+ *
+ * Compile: gcc -O2 bst_practice_iterative.c -o iter
+ * Run:     ./iter [balancedTreeSize] [skewedTreeSize]
+ *          ./iter 1000000 100000000   (needs about 4 GB of memory)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <time.h>
+
+// Node structure
+struct Node {
+    int data;
+    struct Node* left;
+    struct Node* right;
+};
+
+// Create new node
+struct Node* createNode(int value) {
+    struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    newNode->data = value;
+    newNode->left = NULL;
+    newNode->right = NULL;
+    return newNode;
+}
+
+// Insert without recursion (so building a skewed tree is also safe)
+struct Node* insert(struct Node* root, int value) {
+    struct Node* newNode = createNode(value);
+    if (root == NULL) return newNode;
+
+    struct Node* current = root;
+    while (1) {
+        if (value < current->data) {
+            if (current->left == NULL) { current->left = newNode; break; }
+            current = current->left;
+        }
+        else if (value > current->data) {
+            if (current->right == NULL) { current->right = newNode; break; }
+            current = current->right;
+        }
+        else {
+            free(newNode);  // Duplicate
+            break;
+        }
+    }
+    return root;
+}
+
+/*
+ * A GROWABLE STACK OF NODES
+ * -------------------------
+ * Used instead of the call stack. Doubles its size when full.
+ */
+struct NodeStack {
+    struct Node** items;
+    long top;
+    long capacity;
+};
+
+void stackInit(struct NodeStack* s) {
+    s->capacity = 64;
+    s->items = (struct Node**)malloc(s->capacity * sizeof(struct Node*));
+    s->top = 0;
+}
+
+void stackPush(struct NodeStack* s, struct Node* node) {
+    if (s->top == s->capacity) {
+        s->capacity *= 2;
+        s->items = (struct Node**)realloc(s->items, s->capacity * sizeof(struct Node*));
+    }
+    s->items[s->top++] = node;
+}
+
+struct Node* stackPop(struct NodeStack* s) {
+    return s->items[--s->top];
+}
+
+int stackEmpty(struct NodeStack* s) {
+    return s->top == 0;
+}
+
+void stackFree(struct NodeStack* s) {
+    free(s->items);
+}
+
+/*
+ * PROBLEM 1: HEIGHT (ITERATIVE)
+ * -----------------------------
+ * Level order: height = number of levels - 1.
+ * Each level is processed as a whole, so we just count levels.
+ * The queue holds one level at a time (1 node wide for a skewed tree).
+ */
+int findHeightIterative(struct Node* root) {
+    if (root == NULL) return -1;
+
+    long capacity = 64;
+    struct Node** level = (struct Node**)malloc(capacity * sizeof(struct Node*));
+    struct Node** next = (struct Node**)malloc(capacity * sizeof(struct Node*));
+    long levelSize = 1;
+    level[0] = root;
+    int height = -1;
+
+    while (levelSize > 0) {
+        height++;
+        long nextSize = 0;
+
+        for (long i = 0; i < levelSize; i++) {
+            if (nextSize + 2 > capacity) {
+                capacity *= 2;
+                next = (struct Node**)realloc(next, capacity * sizeof(struct Node*));
+                level = (struct Node**)realloc(level, capacity * sizeof(struct Node*));
+            }
+            if (level[i]->left != NULL) next[nextSize++] = level[i]->left;
+            if (level[i]->right != NULL) next[nextSize++] = level[i]->right;
+        }
+
+        // Next level becomes the current level
+        struct Node** temp = level;
+        level = next;
+        next = temp;
+        levelSize = nextSize;
+    }
+
+    free(level);
+    free(next);
+    return height;
+}
+
+/*
+ * PROBLEMS 1 + 2 + 4 IN ONE PASS: HEIGHT, BALANCE, DIAMETER
+ * ---------------------------------------------------------
+ * Postorder (Left -> Right -> Root) with our own stack of "frames".
+ * A frame remembers where we are in a node:
+ *   stage 0: left subtree not visited yet
+ *   stage 1: left done (its height saved), right not visited yet
+ *   stage 2: both done -> compute this node's height
+ *
+ * When a node is finished we know both child heights, so at that moment:
+ *   height   = 1 + max(left, right)
+ *   diameter = max(diameter, left + right + 2)
+ *   balanced = balanced && |left - right| <= 1
+ */
+struct Frame {
+    struct Node* node;
+    int leftHeight;
+    int stage;
+};
+
+struct TreeStats {
+    int height;
+    int diameter;
+    int balanced;
+};
+
+struct TreeStats treeStats(struct Node* root) {
+    struct TreeStats stats = { -1, 0, 1 };
+    if (root == NULL) return stats;
+
+    long capacity = 64;
+    long top = 0;
+    struct Frame* frames = (struct Frame*)malloc(capacity * sizeof(struct Frame));
+    int childHeight = -1;  // Height of the subtree that just finished
+
+    frames[top++] = (struct Frame){ root, 0, 0 };
+
+    while (top > 0) {
+        struct Frame* f = &frames[top - 1];
+        struct Node* child = NULL;
+
+        if (f->stage == 0) {
+            f->stage = 1;
+            child = f->node->left;
+            childHeight = -1;
+        }
+        else if (f->stage == 1) {
+            f->leftHeight = childHeight;
+            f->stage = 2;
+            child = f->node->right;
+            childHeight = -1;
+        }
+        else {
+            int lh = f->leftHeight;
+            int rh = childHeight;
+
+            if (lh + rh + 2 > stats.diameter) stats.diameter = lh + rh + 2;
+            if (lh - rh > 1 || rh - lh > 1) stats.balanced = 0;
+
+            childHeight = 1 + (lh > rh ? lh : rh);
+            top--;
+            continue;
+        }
+
+        if (child != NULL) {
+            if (top == capacity) {
+                capacity *= 2;
+                frames = (struct Frame*)realloc(frames, capacity * sizeof(struct Frame));
+            }
+            frames[top++] = (struct Frame){ child, 0, 0 };
+        }
+    }
+
+    stats.height = childHeight;
+    free(frames);
+    return stats;
+}
+
+/*
+ * PROBLEM 2: IS BALANCED (ITERATIVE, O(n))
+ * PROBLEM 4: DIAMETER (ITERATIVE)
+ * ----------------------------------------
+ */
+int isBalancedIterative(struct Node* root) {
+    return treeStats(root).balanced;
+}
+
+int diameterIterative(struct Node* root) {
+    return treeStats(root).diameter;
+}
+
+/*
+ * PROBLEM 3: MIRROR (ITERATIVE)
+ * -----------------------------
+ * Order doesn't matter: swap children of every node we pop.
+ */
+struct Node* mirrorTreeIterative(struct Node* root) {
+    if (root == NULL) return NULL;
+
+    struct NodeStack s;
+    stackInit(&s);
+    stackPush(&s, root);
+
+    while (!stackEmpty(&s)) {
+        struct Node* node = stackPop(&s);
+
+        struct Node* temp = node->left;
+        node->left = node->right;
+        node->right = temp;
+
+        if (node->left != NULL) stackPush(&s, node->left);
+        if (node->right != NULL) stackPush(&s, node->right);
+    }
+
+    stackFree(&s);
+    return root;
+}
+
+/*
+ * PROBLEM 5: ALL ROOT-TO-LEAF PATHS (ITERATIVE)
+ * ---------------------------------------------
+ * Depth-first with a stack of (node, depth). path[depth] holds the
+ * current node's value; when we pop a node at depth d, entries deeper
+ * than d belong to a finished branch and are simply overwritten.
+ * The path array grows as needed (no "max depth 1000" limit).
+ *
+ * Each complete path is handed to a function, so the same walk can
+ * print paths or, in the benchmark, just measure them.
+ */
+void forEachPath(struct Node* root, void (*visit)(int path[], long length, void* ctx), void* ctx) {
+    if (root == NULL) return;
+
+    long capacity = 64;
+    long top = 0;
+    struct Node** nodes = (struct Node**)malloc(capacity * sizeof(struct Node*));
+    long* depths = (long*)malloc(capacity * sizeof(long));
+    long pathCapacity = 64;
+    int* path = (int*)malloc(pathCapacity * sizeof(int));
+
+    nodes[top] = root;
+    depths[top] = 0;
+    top++;
+
+    while (top > 0) {
+        top--;
+        struct Node* node = nodes[top];
+        long depth = depths[top];
+
+        if (depth == pathCapacity) {
+            pathCapacity *= 2;
+            path = (int*)realloc(path, pathCapacity * sizeof(int));
+        }
+        path[depth] = node->data;
+
+        if (node->left == NULL && node->right == NULL) {
+            visit(path, depth + 1, ctx);
+            continue;
+        }
+
+        if (top + 2 > capacity) {
+            capacity *= 2;
+            nodes = (struct Node**)realloc(nodes, capacity * sizeof(struct Node*));
+            depths = (long*)realloc(depths, capacity * sizeof(long));
+        }
+        // Push right first so the left path comes out first (like the recursive one)
+        if (node->right != NULL) { nodes[top] = node->right; depths[top] = depth + 1; top++; }
+        if (node->left != NULL) { nodes[top] = node->left; depths[top] = depth + 1; top++; }
+    }
+
+    free(nodes);
+    free(depths);
+    free(path);
+}
+
+void printPath(int path[], long length, void* ctx) {
+    (void)ctx;
+    printf("Path: ");
+    for (long i = 0; i < length; i++) {
+        printf("%d ", path[i]);
+    }
+    printf("\n");
+}
+
+void printAllPathsIterative(struct Node* root) {
+    forEachPath(root, printPath, NULL);
+}
+
+/*
+ * PROBLEM 6: GREATER SUM TREE (ITERATIVE)
+ * ---------------------------------------
+ * Reverse inorder (Right -> Root -> Left) with a stack:
+ * go right as far as possible, pop, update, then move to left child.
+ */
+void convertToGreaterSumTreeIterative(struct Node* root) {
+    struct NodeStack s;
+    stackInit(&s);
+    int sum = 0;
+    struct Node* current = root;
+
+    while (current != NULL || !stackEmpty(&s)) {
+        while (current != NULL) {
+            stackPush(&s, current);
+            current = current->right;
+        }
+        current = stackPop(&s);
+        sum += current->data;
+        current->data = sum;
+        current = current->left;
+    }
+
+    stackFree(&s);
+}
+
+/*
+ * PROBLEM 7: DISTANCE BETWEEN TWO NODES (ITERATIVE)
+ * -------------------------------------------------
+ * LCA and level search only ever go one way down, so loops are enough.
+ */
+struct Node* findLCAIterative(struct Node* root, int n1, int n2) {
+    while (root != NULL) {
+        if (n1 < root->data && n2 < root->data) root = root->left;
+        else if (n1 > root->data && n2 > root->data) root = root->right;
+        else break;
+    }
+    return root;
+}
+
+long findLevelIterative(struct Node* root, int value) {
+    long level = 0;
+    while (root != NULL && root->data != value) {
+        root = (value < root->data) ? root->left : root->right;
+        level++;
+    }
+    return root == NULL ? -1 : level;
+}
+
+long findDistanceIterative(struct Node* root, int n1, int n2) {
+    struct Node* lca = findLCAIterative(root, n1, n2);
+    if (lca == NULL) return -1;
+    long d1 = findLevelIterative(lca, n1);
+    long d2 = findLevelIterative(lca, n2);
+    if (d1 < 0 || d2 < 0) return -1;
+    return d1 + d2;
+}
+
+/*
+ * PROBLEM 8: IDENTICAL TREES (ITERATIVE)
+ * --------------------------------------
+ * Two stacks pushed and popped together, so the top entries are always
+ * the nodes at the same position in both trees. NULLs are pushed too:
+ * a NULL on one side only means the shapes differ.
+ */
+int areIdenticalIterative(struct Node* root1, struct Node* root2) {
+    struct NodeStack s1, s2;
+    stackInit(&s1);
+    stackInit(&s2);
+    stackPush(&s1, root1);
+    stackPush(&s2, root2);
+    int identical = 1;
+
+    while (!stackEmpty(&s1)) {
+        struct Node* a = stackPop(&s1);
+        struct Node* b = stackPop(&s2);
+        if (a == NULL && b == NULL) continue;
+        if (a == NULL || b == NULL || a->data != b->data) {
+            identical = 0;
+            break;
+        }
+        stackPush(&s1, a->right); stackPush(&s2, b->right);
+        stackPush(&s1, a->left); stackPush(&s2, b->left);
+    }
+
+    stackFree(&s1);
+    stackFree(&s2);
+    return identical;
+}
+
+/*
+ * PROBLEMS 9, 10, 12: LEAVES, SUM, MAXIMUM (ITERATIVE)
+ * ----------------------------------------------------
+ * Any order works, so one preorder walk with a stack.
+ * The sum is a long long: 100 million values overflow an int.
+ */
+void aggregate(struct Node* root, long* leaves, long long* sum, int* maxValue) {
+    *leaves = 0;
+    *sum = 0;
+    *maxValue = INT_MIN;
+    if (root == NULL) return;
+
+    struct NodeStack s;
+    stackInit(&s);
+    stackPush(&s, root);
+
+    while (!stackEmpty(&s)) {
+        struct Node* node = stackPop(&s);
+        *sum += node->data;
+        if (node->data > *maxValue) *maxValue = node->data;
+        if (node->left == NULL && node->right == NULL) (*leaves)++;
+        if (node->right != NULL) stackPush(&s, node->right);
+        if (node->left != NULL) stackPush(&s, node->left);
+    }
+
+    stackFree(&s);
+}
+
+long countLeavesIterative(struct Node* root) {
+    long leaves; long long sum; int maxValue;
+    aggregate(root, &leaves, &sum, &maxValue);
+    return leaves;
+}
+
+long long sumOfNodesIterative(struct Node* root) {
+    long leaves; long long sum; int maxValue;
+    aggregate(root, &leaves, &sum, &maxValue);
+    return sum;
+}
+
+int findMaxIterative(struct Node* root) {
+    long leaves; long long sum; int maxValue;
+    aggregate(root, &leaves, &sum, &maxValue);
+    return maxValue;
+}
+
+/*
+ * PROBLEM 11: LEVEL ORDER (GROWABLE CIRCULAR QUEUE)
+ * -------------------------------------------------
+ * Queue lives on the heap and doubles when full, so it never overflows.
+ * Circular indexing means memory is only as big as the widest level.
+ */
+void levelOrderIterative(struct Node* root, void (*visit)(struct Node* node, void* ctx), void* ctx) {
+    if (root == NULL) return;
+
+    long capacity = 64;
+    struct Node** queue = (struct Node**)malloc(capacity * sizeof(struct Node*));
+    long front = 0;
+    long count = 0;
+
+    queue[0] = root;
+    count = 1;
+
+    while (count > 0) {
+        struct Node* current = queue[front];
+        front = (front + 1) % capacity;
+        count--;
+        visit(current, ctx);
+
+        if (count + 2 > capacity) {
+            // Unroll the circle into a bigger array
+            struct Node** bigger = (struct Node**)malloc(2 * capacity * sizeof(struct Node*));
+            for (long i = 0; i < count; i++) {
+                bigger[i] = queue[(front + i) % capacity];
+            }
+            free(queue);
+            queue = bigger;
+            front = 0;
+            capacity *= 2;
+        }
+
+        if (current->left != NULL) {
+            queue[(front + count) % capacity] = current->left;
+            count++;
+        }
+        if (current->right != NULL) {
+            queue[(front + count) % capacity] = current->right;
+            count++;
+        }
+    }
+
+    free(queue);
+}
+
+void printNode(struct Node* node, void* ctx) {
+    (void)ctx;
+    printf("%d ", node->data);
+}
+
+// Inorder without recursion (for display)
+void inorderIterative(struct Node* root) {
+    struct NodeStack s;
+    stackInit(&s);
+    struct Node* current = root;
+
+    while (current != NULL || !stackEmpty(&s)) {
+        while (current != NULL) {
+            stackPush(&s, current);
+            current = current->left;
+        }
+        current = stackPop(&s);
+        printf("%d ", current->data);
+        current = current->right;
+    }
+
+    stackFree(&s);
+}
+
+// Free every node without recursion
+void freeTreeIterative(struct Node* root) {
+    if (root == NULL) return;
+
+    struct NodeStack s;
+    stackInit(&s);
+    stackPush(&s, root);
+
+    while (!stackEmpty(&s)) {
+        struct Node* node = stackPop(&s);
+        if (node->left != NULL) stackPush(&s, node->left);
+        if (node->right != NULL) stackPush(&s, node->right);
+        free(node);
+    }
+
+    stackFree(&s);
+}
+
+/*
+ * RECURSIVE VERSIONS (from bst_practice_problems.c) FOR COMPARISON
+ * ----------------------------------------------------------------
+ */
+int findHeight(struct Node* root) {
+    if (root == NULL) return -1;
+    int leftHeight = findHeight(root->left);
+    int rightHeight = findHeight(root->right);
+    return 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+}
+
+int isBalanced(struct Node* root) {
+    if (root == NULL) return 1;
+    int leftHeight = findHeight(root->left);
+    int rightHeight = findHeight(root->right);
+    if (abs(leftHeight - rightHeight) > 1) return 0;
+    return isBalanced(root->left) && isBalanced(root->right);
+}
+
+int findDiameter(struct Node* root, int* maxDiameter) {
+    if (root == NULL) return -1;
+    int leftHeight = findDiameter(root->left, maxDiameter);
+    int rightHeight = findDiameter(root->right, maxDiameter);
+    if (leftHeight + rightHeight + 2 > *maxDiameter) {
+        *maxDiameter = leftHeight + rightHeight + 2;
+    }
+    return 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+}
+
+int diameter(struct Node* root) {
+    int maxDiameter = 0;
+    findDiameter(root, &maxDiameter);
+    return maxDiameter;
+}
+
+void convertToGSTUtil(struct Node* root, int* sum) {
+    if (root == NULL) return;
+    convertToGSTUtil(root->right, sum);
+    *sum += root->data;
+    root->data = *sum;
+    convertToGSTUtil(root->left, sum);
+}
+
+int areIdentical(struct Node* root1, struct Node* root2) {
+    if (root1 == NULL && root2 == NULL) return 1;
+    if (root1 == NULL || root2 == NULL) return 0;
+    return (root1->data == root2->data) &&
+           areIdentical(root1->left, root2->left) &&
+           areIdentical(root1->right, root2->right);
+}
+
+int countLeaves(struct Node* root) {
+    if (root == NULL) return 0;
+    if (root->left == NULL && root->right == NULL) return 1;
+    return countLeaves(root->left) + countLeaves(root->right);
+}
+
+long long sumOfNodes(struct Node* root) {
+    if (root == NULL) return 0;
+    return root->data + sumOfNodes(root->left) + sumOfNodes(root->right);
+}
+
+/*
+ * BENCHMARK HELPERS
+ * -----------------
+ * Benchmark trees are built inside one big array of nodes:
+ * one malloc, one free, no recursion.
+ */
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Perfectly balanced tree over values 0..n-1, built with an explicit stack
+struct Node* buildBalanced(struct Node* pool, long n) {
+    if (n <= 0) return NULL;
+
+    // Each stack entry: range [lo, hi] and where to store the subtree's root
+    long capacity = 128;
+    long top = 0;
+    long* lo = (long*)malloc(capacity * sizeof(long));
+    long* hi = (long*)malloc(capacity * sizeof(long));
+    struct Node*** slot = (struct Node***)malloc(capacity * sizeof(struct Node**));
+    struct Node* root = NULL;
+
+    lo[0] = 0; hi[0] = n - 1; slot[0] = &root; top = 1;
+
+    while (top > 0) {
+        top--;
+        long l = lo[top], h = hi[top];
+        struct Node** where = slot[top];
+        if (l > h) { *where = NULL; continue; }
+
+        long mid = l + (h - l) / 2;
+        struct Node* node = &pool[mid];
+        node->data = (int)mid;
+        *where = node;
+
+        lo[top] = l; hi[top] = mid - 1; slot[top] = &node->left; top++;
+        lo[top] = mid + 1; hi[top] = h; slot[top] = &node->right; top++;
+    }
+
+    free(lo);
+    free(hi);
+    free(slot);
+    return root;
+}
+
+// Skewed tree 0 -> 1 -> 2 -> ... (every node only has a right child)
+struct Node* buildSkewed(struct Node* pool, long n) {
+    for (long i = 0; i < n; i++) {
+        pool[i].data = (int)i;
+        pool[i].left = NULL;
+        pool[i].right = (i + 1 < n) ? &pool[i + 1] : NULL;
+    }
+    return n > 0 ? &pool[0] : NULL;
+}
+
+void countPath(int path[], long length, void* ctx) {
+    (void)path;
+    *(long*)ctx += length;
+}
+
+void countNode(struct Node* node, void* ctx) {
+    (void)node;
+    (*(long*)ctx)++;
+}
+
+void benchmarkBalanced(long n) {
+    struct Node* pool = (struct Node*)malloc(n * sizeof(struct Node));
+    struct Node* copyPool = (struct Node*)malloc(n * sizeof(struct Node));
+    if (pool == NULL || copyPool == NULL) {
+        printf("Not enough memory for a %ld node balanced tree\n", n);
+        free(pool);
+        free(copyPool);
+        return;
+    }
+    struct Node* root = buildBalanced(pool, n);
+    struct Node* copy = buildBalanced(copyPool, n);
+    double t;
+    int maxDiameter;
+
+    printf("Balanced tree, %ld nodes (recursion is safe here, height %d)\n", n, findHeightIterative(root));
+    printf("Problem               | Recursive   | Iterative   | Same answer\n");
+    printf("----------------------+-------------+-------------+------------\n");
+
+    t = nowSeconds(); int h1 = findHeight(root); double r = nowSeconds() - t;
+    t = nowSeconds(); int h2 = findHeightIterative(root); double it = nowSeconds() - t;
+    printf("Height                | %8.2f ms | %8.2f ms | %s\n", r * 1e3, it * 1e3, h1 == h2 ? "yes" : "NO");
+
+    t = nowSeconds(); int b1 = isBalanced(root); r = nowSeconds() - t;
+    t = nowSeconds(); int b2 = isBalancedIterative(root); it = nowSeconds() - t;
+    printf("Is balanced           | %8.2f ms | %8.2f ms | %s\n", r * 1e3, it * 1e3, b1 == b2 ? "yes" : "NO");
+
+    t = nowSeconds(); int d1 = diameter(root); r = nowSeconds() - t;
+    t = nowSeconds(); int d2 = diameterIterative(root); it = nowSeconds() - t;
+    printf("Diameter              | %8.2f ms | %8.2f ms | %s\n", r * 1e3, it * 1e3, d1 == d2 ? "yes" : "NO");
+
+    // Three separate recursive passes vs one combined pass
+    t = nowSeconds();
+    maxDiameter = 0;
+    h1 = findHeight(root); b1 = isBalanced(root); findDiameter(root, &maxDiameter);
+    r = nowSeconds() - t;
+    t = nowSeconds(); struct TreeStats stats = treeStats(root); it = nowSeconds() - t;
+    printf("Height+balance+diam.  | %8.2f ms | %8.2f ms | %s\n", r * 1e3, it * 1e3,
+           (h1 == stats.height && b1 == stats.balanced && maxDiameter == stats.diameter) ? "yes" : "NO");
+
+    t = nowSeconds(); int i1 = areIdentical(root, copy); r = nowSeconds() - t;
+    t = nowSeconds(); int i2 = areIdenticalIterative(root, copy); it = nowSeconds() - t;
+    printf("Identical (copy)      | %8.2f ms | %8.2f ms | %s\n", r * 1e3, it * 1e3, i1 == i2 && i1 ? "yes" : "NO");
+
+    t = nowSeconds(); int l1 = countLeaves(root); r = nowSeconds() - t;
+    t = nowSeconds(); long l2 = countLeavesIterative(root); it = nowSeconds() - t;
+    printf("Count leaves          | %8.2f ms | %8.2f ms | %s\n", r * 1e3, it * 1e3, l1 == l2 ? "yes" : "NO");
+
+    t = nowSeconds(); long long s1 = sumOfNodes(root); r = nowSeconds() - t;
+    t = nowSeconds(); long long s2 = sumOfNodesIterative(root); it = nowSeconds() - t;
+    printf("Sum of nodes          | %8.2f ms | %8.2f ms | %s\n", r * 1e3, it * 1e3, s1 == s2 ? "yes" : "NO");
+
+    // Greater Sum Tree: the running sum of 0..n-1 overflows an int,
+    // so reset the values to 0/1 before each version
+    for (long i = 0; i < n; i++) pool[i].data = (int)(i & 1);
+    t = nowSeconds(); int gst = 0; convertToGSTUtil(root, &gst); r = nowSeconds() - t;
+    int afterRecursive = root->data;
+    for (long i = 0; i < n; i++) pool[i].data = (int)(i & 1);
+    t = nowSeconds(); convertToGreaterSumTreeIterative(root); it = nowSeconds() - t;
+    printf("Greater Sum Tree      | %8.2f ms | %8.2f ms | %s\n", r * 1e3, it * 1e3,
+           afterRecursive == root->data ? "yes" : "NO");
+
+    free(pool);
+    free(copyPool);
+}
+
+void benchmarkSkewed(long n) {
+    struct Node* pool = (struct Node*)malloc(n * sizeof(struct Node));
+    if (pool == NULL) {
+        printf("Not enough memory for a %ld node skewed tree\n", n);
+        return;
+    }
+    struct Node* root = buildSkewed(pool, n);
+    double t;
+
+    printf("\nSkewed tree, %ld nodes (height %ld): recursive versions would need\n", n, n - 1);
+    printf("about %ld MB of call stack and crash, iterative versions:\n", n * 48 / (1024 * 1024));
+    printf("Problem               | Iterative   | Answer\n");
+    printf("----------------------+-------------+------------------\n");
+
+    t = nowSeconds(); int h = findHeightIterative(root);
+    printf("Height                | %8.2f ms | %d\n", (nowSeconds() - t) * 1e3, h);
+
+    t = nowSeconds(); struct TreeStats stats = treeStats(root);
+    printf("Height+balance+diam.  | %8.2f ms | %d, %s, %d\n", (nowSeconds() - t) * 1e3,
+           stats.height, stats.balanced ? "balanced" : "not balanced", stats.diameter);
+
+    t = nowSeconds(); long long sum = sumOfNodesIterative(root);
+    printf("Sum of nodes          | %8.2f ms | %lld\n", (nowSeconds() - t) * 1e3, sum);
+
+    // Against itself: still walks every node, without a second 10M node tree
+    t = nowSeconds(); int identical = areIdenticalIterative(root, root);
+    printf("Identical (itself)    | %8.2f ms | %s\n", (nowSeconds() - t) * 1e3, identical ? "yes" : "no");
+
+    long pathLength = 0;
+    t = nowSeconds(); forEachPath(root, countPath, &pathLength);
+    printf("Root-to-leaf paths    | %8.2f ms | total length %ld\n", (nowSeconds() - t) * 1e3, pathLength);
+
+    long visited = 0;
+    t = nowSeconds(); levelOrderIterative(root, countNode, &visited);
+    printf("Level order           | %8.2f ms | %ld nodes\n", (nowSeconds() - t) * 1e3, visited);
+
+    t = nowSeconds(); mirrorTreeIterative(root);
+    printf("Mirror                | %8.2f ms | root->left %s\n", (nowSeconds() - t) * 1e3,
+           root->left != NULL ? "set" : "NULL");
+
+    mirrorTreeIterative(root);      // Back to a BST before searching it, outside the timer
+    t = nowSeconds(); long distance = findDistanceIterative(root, 0, (int)(n - 1));
+    printf("Distance first-last   | %8.2f ms | %ld\n", (nowSeconds() - t) * 1e3, distance);
+
+    free(pool);
+}
+
+/*
+ * MAIN FUNCTION - SAME DEMO AS bst_practice_problems.c, THEN BENCHMARK
+ * --------------------------------------------------------------------
+ */
+int main(int argc, char* argv[]) {
+    long balancedSize = argc > 1 ? atol(argv[1]) : 1000000;
+    long skewedSize = argc > 2 ? atol(argv[2]) : 10000000;
+    struct Node* root = NULL;
+
+    printf("=== BST PRACTICE PROBLEMS (ITERATIVE) ===\n\n");
+
+    printf("Creating BST: 50, 30, 70, 20, 40, 60, 80\n");
+    int values[] = {50, 30, 70, 20, 40, 60, 80};
+    for (int i = 0; i < 7; i++) {
+        root = insert(root, values[i]);
+    }
+    printf("Inorder: ");
+    inorderIterative(root);
+    printf("\n\n");
+
+    struct TreeStats stats = treeStats(root);
+    printf("1. Height of tree: %d\n", findHeightIterative(root));
+    printf("2. Is tree balanced? %s\n", isBalancedIterative(root) ? "Yes" : "No");
+    printf("3. Inorder after mirror: ");
+    mirrorTreeIterative(root);
+    inorderIterative(root);
+    mirrorTreeIterative(root);
+    printf("\n4. Diameter of tree: %d\n", diameterIterative(root));
+    printf("   (one pass: height %d, diameter %d, balanced %s)\n",
+           stats.height, stats.diameter, stats.balanced ? "Yes" : "No");
+    printf("5. All root-to-leaf paths:\n");
+    printAllPathsIterative(root);
+
+    struct Node* gstRoot = NULL;
+    int gstValues[] = {4, 2, 6, 1, 3};
+    for (int i = 0; i < 5; i++) {
+        gstRoot = insert(gstRoot, gstValues[i]);
+    }
+    printf("6. Greater Sum Tree before: ");
+    inorderIterative(gstRoot);
+    convertToGreaterSumTreeIterative(gstRoot);
+    printf("\n   After:  ");
+    inorderIterative(gstRoot);
+
+    printf("\n7. Distance between 20 and 80: %ld\n", findDistanceIterative(root, 20, 80));
+
+    struct Node* root2 = NULL;
+    root2 = insert(root2, 50);
+    root2 = insert(root2, 30);
+    printf("8. Are trees identical? %s\n", areIdenticalIterative(root, root2) ? "Yes" : "No");
+    for (int i = 2; i < 7; i++) {
+        root2 = insert(root2, values[i]);
+    }
+    printf("   After inserting the rest: %s\n", areIdenticalIterative(root, root2) ? "Yes" : "No");
+    printf("9. Number of leaf nodes: %ld\n", countLeavesIterative(root));
+    printf("10. Sum of all nodes: %lld\n", sumOfNodesIterative(root));
+    printf("11. Level order traversal: ");
+    levelOrderIterative(root, printNode, NULL);
+    printf("\n12. Maximum value: %d\n\n", findMaxIterative(root));
+    freeTreeIterative(root);
+    freeTreeIterative(gstRoot);
+    freeTreeIterative(root2);
+
+    benchmarkBalanced(balancedSize);
+    benchmarkSkewed(skewedSize);
+
+    printf("\n");
+    return 0;
+}
@@ -333,28 +333,38 @@ int sumOfNodes(struct Node* root) {
  * Print nodes level by level
  * 
  * Approach: Use queue (here we use simple array-based queue)
+ * The array starts small and doubles when full, so any tree size works
  */
 void levelOrder(struct Node* root) {
     if (root == NULL) return;
-    
-    // Simple array-based queue
-    struct Node* queue[1000];
+
+    // Simple array-based queue (grows with realloc)
+    int capacity = 16;
+    struct Node** queue = (struct Node**)malloc(capacity * sizeof(struct Node*));
     int front = 0, rear = 0;
-    
+
     queue[rear++] = root;
-    
+
     while (front < rear) {
         struct Node* current = queue[front++];
         printf("%d ", current->data);
-        
+
+        // Room for both children
+        if (rear + 2 > capacity) {
+            capacity *= 2;
+            queue = (struct Node**)realloc(queue, capacity * sizeof(struct Node*));
+        }
+
         if (current->left != NULL) {
             queue[rear++] = current->left;
         }
-        
+
         if (current->right != NULL) {
             queue[rear++] = current->right;
         }
     }
+
+    free(queue);
 }
 
 /*
@@ -0,0 +1,328 @@
+/*
+ * PARALLEL TREE BUILD AND TRAVERSAL WITH A WORK-STEALING TASK POOL
+ * ================================================================
+ *
+ * Problem:
+ * sortedArrayToBST, countNodes, height, sumOfNodes and countLeaves all
+ * run on one thread. On a tree with tens of millions of nodes the other
+ * cores just sit there.
+ *
+ * All of these are "divide and conquer" on the tree:
+ *   do the left subtree, do the right subtree, combine
+ * and the two halves never touch the same nodes, so they can run on
+ * different cores at the same time (FORK-JOIN).
+ *
+ * Why not just pthread_create for the left half (like the set operations
+ * file)? Creating a thread costs tens of microseconds, and a skewed tree
+ * gives one thread all the work. A TASK POOL fixes both:
+ *
+ *   - N worker threads are created once
+ *   - Each worker has its own DEQUE of small tasks
+ *   - taskSpawn(task): push onto the BOTTOM of my own deque (cheap)
+ *   - taskSync(task):  wait for it - but while waiting, run tasks myself:
+ *                      first my own deque bottom, otherwise STEAL from
+ *                      the TOP of another worker's deque
+ *
+ * The top of a deque holds the OLDEST task, which in divide and conquer
+ * is the BIGGEST piece of work, so one steal keeps a thief busy for a
+ * long time. Idle workers balance the load by themselves.
+ *
+ * Tasks live on the stack of the function that spawned them. That is safe
+ * because fork-join always syncs a task before returning.
+ *
+ * Compile: gcc -O2 -pthread parallel_tree_tasks.c ../common/task_pool.c ../common/ws_deque.c -o ptree
+ * Run:     ./ptree [treeSize] [maxThreads]
+ *          ./ptree 50000000 8
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "../common/task_pool.h"
+
+// Node structure
+struct Node {
+    int data;
+    struct Node* left;
+    struct Node* right;
+};
+
+/*
+ * THE TASK POOL
+ * -------------
+ * The pool itself is ../common/task_pool.c (shared with Unit_1's
+ * task_pool_bench.c). Its deques are Chase-Lev deques (ws_deque.c):
+ * the owner pushes and pops without taking a lock, only thieves use a
+ * compare-and-swap, so spawning millions of small tasks stays cheap.
+ */
+#define SPAWN_DEPTH 12      // Reductions stop spawning below this depth
+#define BUILD_GRAIN 16384   // Ranges smaller than this are built on one thread
+
+/*
+ * SEQUENTIAL VERSIONS (same as bst_applications.c / bst_basic_operations.c)
+ * -------------------------------------------------------------------------
+ * The benchmark tree is built inside one big array of nodes instead of
+ * one malloc per node: with many threads malloc itself becomes the
+ * bottleneck, and one free at the end is much faster.
+ * Node for arr[mid] is nodes[mid], so every thread writes its own nodes.
+ */
+struct Node* sortedArrayToBST(int arr[], long start, long end, struct Node* nodes) {
+    if (start > end) {
+        return NULL;
+    }
+
+    long mid = start + (end - start) / 2;
+    struct Node* root = &nodes[mid];
+    root->data = arr[mid];
+    root->left = sortedArrayToBST(arr, start, mid - 1, nodes);
+    root->right = sortedArrayToBST(arr, mid + 1, end, nodes);
+    return root;
+}
+
+long countNodes(struct Node* root) {
+    if (root == NULL) return 0;
+    return 1 + countNodes(root->left) + countNodes(root->right);
+}
+
+long height(struct Node* root) {
+    if (root == NULL) return -1;
+    long leftHeight = height(root->left);
+    long rightHeight = height(root->right);
+    return 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+}
+
+long long sumOfNodes(struct Node* root) {
+    if (root == NULL) return 0;
+    return root->data + sumOfNodes(root->left) + sumOfNodes(root->right);
+}
+
+long countLeaves(struct Node* root) {
+    if (root == NULL) return 0;
+    if (root->left == NULL && root->right == NULL) return 1;
+    return countLeaves(root->left) + countLeaves(root->right);
+}
+
+/*
+ * PARALLEL SORTED ARRAY TO BST
+ * ----------------------------
+ * Same as sortedArrayToBST, but the left half is spawned as a task and
+ * the right half is done by this thread. Small ranges are built
+ * sequentially: a task has to do enough work to be worth stealing.
+ */
+struct BuildArgs {
+    int* arr;
+    long start;
+    long end;
+    struct Node* nodes;
+    struct Node** result;   // Where to store the subtree's root
+};
+
+void buildTask(void* p) {
+    struct BuildArgs* args = (struct BuildArgs*)p;
+
+    if (args->end - args->start + 1 <= BUILD_GRAIN) {
+        *args->result = sortedArrayToBST(args->arr, args->start, args->end, args->nodes);
+        return;
+    }
+
+    long mid = args->start + (args->end - args->start) / 2;
+    struct Node* root = &args->nodes[mid];
+    root->data = args->arr[mid];
+    *args->result = root;
+
+    struct BuildArgs leftArgs = { args->arr, args->start, mid - 1, args->nodes, &root->left };
+    struct BuildArgs rightArgs = { args->arr, mid + 1, args->end, args->nodes, &root->right };
+    Task leftTask;
+
+    taskInit(&leftTask, buildTask, &leftArgs);
+    taskSpawn(&leftTask);
+    buildTask(&rightArgs);
+    taskSync(&leftTask);
+}
+
+struct Node* parallelSortedArrayToBST(TaskPool* pool, int arr[], long n, struct Node* nodes) {
+    struct Node* root = NULL;
+    struct BuildArgs args = { arr, 0, n - 1, nodes, &root };
+    poolRun(pool, buildTask, &args);
+    return root;
+}
+
+/*
+ * PARALLEL REDUCTIONS
+ * -------------------
+ * countNodes, height, sumOfNodes and countLeaves have the same shape:
+ *   result = combine(node, reduce(left), reduce(right))
+ * so one parallel function handles all four, chosen by an enum.
+ *
+ * We don't know subtree sizes, so spawning stops at SPAWN_DEPTH
+ * (up to 2^12 tasks, plenty for load balancing). A skewed tree still
+ * works: it just gives fewer tasks, never wrong answers.
+ */
+enum Reduction { COUNT_NODES, HEIGHT, SUM_OF_NODES, COUNT_LEAVES };
+
+const char* reductionNames[] = { "countNodes", "height", "sumOfNodes", "countLeaves" };
+
+long long sequentialReduce(enum Reduction op, struct Node* root) {
+    switch (op) {
+        case COUNT_NODES:  return countNodes(root);
+        case HEIGHT:       return height(root);
+        case SUM_OF_NODES: return sumOfNodes(root);
+        default:           return countLeaves(root);
+    }
+}
+
+long long combine(enum Reduction op, struct Node* node, long long left, long long right) {
+    switch (op) {
+        case COUNT_NODES:  return 1 + left + right;
+        case HEIGHT:       return 1 + (left > right ? left : right);
+        case SUM_OF_NODES: return node->data + left + right;
+        default:
+            if (node->left == NULL && node->right == NULL) return 1;
+            return left + right;
+    }
+}
+
+struct ReduceArgs {
+    enum Reduction op;
+    struct Node* root;
+    int depth;
+    long long result;
+};
+
+void reduceTask(void* p) {
+    struct ReduceArgs* args = (struct ReduceArgs*)p;
+    struct Node* root = args->root;
+
+    if (root == NULL || args->depth >= SPAWN_DEPTH) {
+        args->result = sequentialReduce(args->op, root);
+        return;
+    }
+
+    struct ReduceArgs leftArgs = { args->op, root->left, args->depth + 1, 0 };
+    struct ReduceArgs rightArgs = { args->op, root->right, args->depth + 1, 0 };
+    Task leftTask;
+
+    taskInit(&leftTask, reduceTask, &leftArgs);
+    taskSpawn(&leftTask);
+    reduceTask(&rightArgs);
+    taskSync(&leftTask);
+
+    args->result = combine(args->op, root, leftArgs.result, rightArgs.result);
+}
+
+long long parallelReduce(TaskPool* pool, enum Reduction op, struct Node* root) {
+    struct ReduceArgs args = { op, root, 0, 0 };
+    poolRun(pool, reduceTask, &args);
+    return args.result;
+}
+
+long parallelCountNodes(TaskPool* pool, struct Node* root) { return (long)parallelReduce(pool, COUNT_NODES, root); }
+long parallelHeight(TaskPool* pool, struct Node* root) { return (long)parallelReduce(pool, HEIGHT, root); }
+long long parallelSumOfNodes(TaskPool* pool, struct Node* root) { return parallelReduce(pool, SUM_OF_NODES, root); }
+long parallelCountLeaves(TaskPool* pool, struct Node* root) { return (long)parallelReduce(pool, COUNT_LEAVES, root); }
+
+/*
+ * BENCHMARK
+ * ---------
+ */
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[]) {
+    long n = argc > 1 ? atol(argv[1]) : 10000000;
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int maxThreads = argc > 2 ? atoi(argv[2]) : (int)(cores < 1 ? 1 : cores);
+    if (maxThreads < 1) maxThreads = 1;
+
+    printf("=== PARALLEL TREE BUILD AND TRAVERSAL (WORK STEALING) ===\n\n");
+
+    // Small demo first
+    int small[] = {10, 20, 30, 40, 50, 60, 70};
+    struct Node smallNodes[7];
+    TaskPool* pool = poolCreate(maxThreads);
+    if (pool == NULL) {
+        printf("Not enough memory for %d workers\n", maxThreads);
+        return 1;
+    }
+    struct Node* demo = parallelSortedArrayToBST(pool, small, 7, smallNodes);
+    printf("Built from sorted array {10..70}: root %d\n", demo->data);
+    printf("countNodes %ld, height %ld, sumOfNodes %lld, countLeaves %ld\n\n",
+           parallelCountNodes(pool, demo), parallelHeight(pool, demo),
+           parallelSumOfNodes(pool, demo), parallelCountLeaves(pool, demo));
+    poolDestroy(pool);
+
+    int* arr = (int*)malloc(n * sizeof(int));
+    struct Node* nodes = (struct Node*)malloc(n * sizeof(struct Node));
+    if (arr == NULL || nodes == NULL) {
+        printf("Not enough memory for %ld nodes\n", n);
+        return 1;
+    }
+    for (long i = 0; i < n; i++) {
+        arr[i] = (int)(2 * i);
+    }
+    // Warm-up build: the first pass over fresh memory pays for page faults
+    sortedArrayToBST(arr, 0, n - 1, nodes);
+
+    printf("Tree size: %ld nodes, %ld core(s) online\n\n", n, cores);
+
+    // Sequential baselines
+    double t = nowSeconds();
+    struct Node* root = sortedArrayToBST(arr, 0, n - 1, nodes);
+    double seqBuild = nowSeconds() - t;
+
+    double seqReduce[4];
+    long long expected[4];
+    for (int op = 0; op < 4; op++) {
+        t = nowSeconds();
+        expected[op] = sequentialReduce((enum Reduction)op, root);
+        seqReduce[op] = nowSeconds() - t;
+    }
+
+    printf("Sequential: build %.1f ms", seqBuild * 1e3);
+    for (int op = 0; op < 4; op++) {
+        printf(", %s %.1f ms", reductionNames[op], seqReduce[op] * 1e3);
+    }
+    printf("\n\n");
+
+    printf("Threads | Build ms (speedup) | countNodes  | height      | sumOfNodes  | countLeaves | Steals | Correct\n");
+    printf("--------+--------------------+-------------+-------------+-------------+-------------+--------+--------\n");
+
+    for (int threads = 1; ; threads *= 2) {
+        if (threads > maxThreads) threads = maxThreads;
+        pool = poolCreate(threads);
+        if (pool == NULL) {
+            printf("Not enough memory for %d workers\n", threads);
+            break;
+        }
+
+        t = nowSeconds();
+        struct Node* parallelRoot = parallelSortedArrayToBST(pool, arr, n, nodes);
+        double build = nowSeconds() - t;
+        int correct = (parallelRoot == root);
+
+        printf("%7d | %8.1f (%5.2fx)  ", threads, build * 1e3, seqBuild / build);
+        for (int op = 0; op < 4; op++) {
+            t = nowSeconds();
+            long long value = parallelReduce(pool, (enum Reduction)op, parallelRoot);
+            double elapsed = nowSeconds() - t;
+            if (value != expected[op]) correct = 0;
+            printf("| %5.1f %5.2fx ", elapsed * 1e3, seqReduce[op] / elapsed);
+        }
+        printf("| %6ld | %s\n", poolSteals(pool), correct ? "yes" : "NO");
+
+        poolDestroy(pool);
+        if (threads == maxThreads) break;
+    }
+
+    if (cores < 2) {
+        printf("\nOnly one core online: extra threads just take turns, expect no speedup.\n");
+    }
+
+    free(arr);
+    free(nodes);
+    return 0;
+}
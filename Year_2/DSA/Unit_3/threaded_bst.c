@@ -249,23 +249,126 @@ void preorder(struct Node* root) {
         if (current->left != NULL) {
             current = current->left;
         }
-        // Otherwise, follow the thread or right child
-        else if (!current->isThreaded) {
-            current = current->right;
-        }
         else {
-            // Follow thread and find next node to visit
-            current = current->right;
-            while (current != NULL && current->left == NULL && current->isThreaded) {
+            // Follow threads up to the first node that has a real right child,
+            // (its left side is already printed) then visit that right child
+            while (current != NULL && current->isThreaded) {
                 current = current->right;
             }
-            if (current != NULL && current->left == NULL) {
+            if (current != NULL) {
                 current = current->right;
             }
         }
     }
 }
 
+/*
+ * UNLINK A NODE WITH AT MOST ONE CHILD
+ * ------------------------------------
+ * Helper for deleteNode. Removes 'node' (child of 'parent') and
+ * repairs the one thread that can point at it.
+ *
+ * Who has a thread pointing to 'node'?
+ * Only its inorder predecessor, and only when the predecessor is the
+ * rightmost node of node's left subtree.
+ *
+ * Three cases:
+ * 1. Leaf: parent simply loses the child
+ *    - If it was parent's right child, parent's right becomes a
+ *      thread again (to node's successor)
+ * 2. Only left child: the rightmost node of the left subtree threads
+ *    to 'node', so make it thread to node's successor instead
+ * 3. Only right child: nobody threads to 'node', just splice it out
+ */
+struct Node* removeNode(struct Node* root, struct Node* parent, struct Node* node) {
+    struct Node* child;
+
+    if (node->left != NULL) {
+        // Case 2: fix the predecessor's thread before splicing
+        struct Node* pred = node->left;
+        while (!pred->isThreaded) {
+            pred = pred->right;
+        }
+        pred->right = node->right;  // node's right is a thread to its successor
+        child = node->left;
+    }
+    else if (!node->isThreaded) {
+        // Case 3: right child only
+        child = node->right;
+    }
+    else {
+        // Case 1: leaf
+        child = NULL;
+    }
+
+    if (parent == NULL) {
+        root = child;
+    }
+    else if (parent->left == node) {
+        parent->left = child;
+    }
+    else if (child != NULL) {
+        parent->right = child;
+    }
+    else {
+        // Parent's right becomes a thread to node's successor
+        parent->right = node->right;
+        parent->isThreaded = 1;
+    }
+
+    free(node);
+    return root;
+}
+
+/*
+ * DELETE A VALUE FROM THREADED BST
+ * --------------------------------
+ * Same three cases as a normal BST, but threads must stay correct.
+ *
+ * For a node with two children we copy the inorder successor's data
+ * into it and delete the successor instead. The successor is the
+ * leftmost node of the right subtree, so it has no left child and
+ * removeNode can handle it.
+ */
+struct Node* deleteNode(struct Node* root, int value) {
+    struct Node* parent = NULL;
+    struct Node* current = root;
+
+    // Find the node (and its parent)
+    while (current != NULL && current->data != value) {
+        parent = current;
+
+        if (value < current->data) {
+            current = current->left;
+        }
+        else if (current->isThreaded) {
+            current = NULL;  // Right is a thread, value not in tree
+        }
+        else {
+            current = current->right;
+        }
+    }
+
+    if (current == NULL) {
+        return root;  // Value not found
+    }
+
+    // Two children: replace with successor, then delete the successor
+    if (current->left != NULL && !current->isThreaded) {
+        struct Node* succParent = current;
+        struct Node* succ = current->right;
+        while (succ->left != NULL) {
+            succParent = succ;
+            succ = succ->left;
+        }
+
+        current->data = succ->data;
+        return removeNode(root, succParent, succ);
+    }
+
+    return removeNode(root, parent, current);
+}
+
 /*
  * COUNT TOTAL NODES
  * ----------------
@@ -398,7 +501,20 @@ int main() {
     if (succ != NULL) {
         printf("%d", succ->data);
     }
-    
+
+    // Delete: leaf, node with one child, node with two children
+    printf("\n\nDeleting 5 (leaf), 10 (one child) and 20 (two children, root)...\n");
+    root = deleteNode(root, 5);
+    root = deleteNode(root, 10);
+    root = deleteNode(root, 20);
+
+    printf("\nTree structure after deletion:\n");
+    displayTree(root, 0);
+
+    printf("\n\nInorder traversal (threads still correct): ");
+    inorder(root);
+    printf("\nTotal nodes: %d", countNodes(root));
+
     printf("\n\n");
     return 0;
 }
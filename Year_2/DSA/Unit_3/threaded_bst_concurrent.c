@@ -0,0 +1,663 @@
+/*
+ * THREADED BST - MANY READERS, ONE WRITER
+ * =======================================
+ *
+ * threaded_bst.c shows that right threads let us do inorder traversal
+ * without recursion or a stack. This file uses that property to let
+ * MANY reader threads walk the tree in order at the same time as ONE
+ * writer thread inserts and deletes - with no locks at all.
+ *
+ * Why does threading help here?
+ * A reader only ever needs "the node I am standing on". From it, the
+ * next node is found by following one right pointer (and then some left
+ * pointers). No stack of ancestors is kept, so nothing the reader
+ * remembers can go stale when the writer changes the tree.
+ *
+ * Three problems to solve:
+ *
+ * 1. PUBLISHING SAFELY (atomics)
+ *    - A new node is fully filled in BEFORE it is linked into the tree
+ *    - Links are written with a "release" store, readers use "acquire"
+ *      loads, so a reader that sees the link also sees the node's data
+ *    - The thread flag lives in the lowest bit of the right pointer,
+ *      so pointer + flag change together in ONE atomic store
+ *
+ * 2. NEVER CHANGING A VISIBLE VALUE
+ *    The normal delete copies the successor's data into the deleted node.
+ *    A reader standing there would see the value change under it.
+ *    Instead we build a NEW node holding the successor's value and swap
+ *    it in. Removed nodes keep pointing forward, so a reader standing on
+ *    a removed node still reaches a larger value next.
+ *
+ * 3. FREEING MEMORY (epoch based reclamation)
+ *    The writer cannot free() a removed node right away - a reader may
+ *    be standing on it. So:
+ *    - There is a global epoch counter
+ *    - A reader copies the epoch into its own slot when it starts a
+ *      traversal and clears the slot when it finishes
+ *    - Removed nodes go into a "limbo" list for the current epoch
+ *    - The epoch only moves forward when every active reader has seen
+ *      the current epoch. Then nodes removed two epochs ago cannot be
+ *      reached by anyone and are freed.
+ *
+ * What a reader is promised:
+ * - Values come out in strictly increasing order
+ * - It never touches freed memory and always finishes
+ * - Keys not touched by the writer during the traversal are all seen
+ *   (a key being inserted, deleted or moved may or may not be seen)
+ *
+ * Compile: gcc -O2 -pthread threaded_bst_concurrent.c -o tbst
+ * Run:     ./tbst [treeSize] [secondsPerRun] [maxReaders]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#define THREAD_BIT ((uintptr_t)1)   // Low bit of right pointer: 1 = thread
+#define MAX_READERS 64
+#define RETIRE_BATCH 64             // Try to advance the epoch this often
+
+// Node structure (same idea as threaded_bst.c, but links are atomic)
+struct Node {
+    int data;                    // Never changes once the node is in the tree
+    struct Node* _Atomic left;
+    _Atomic uintptr_t right;     // Pointer to right child or successor, plus THREAD_BIT
+    struct Node* retiredNext;    // Used only by the writer's limbo lists
+};
+
+// One slot per reader, padded so readers don't share a cache line
+struct ReaderSlot {
+    _Atomic unsigned long epoch;  // 0 = not reading
+    char pad[64 - sizeof(unsigned long)];
+};
+
+struct SharedTree {
+    struct Node* _Atomic root;
+    _Atomic unsigned long globalEpoch;
+    struct ReaderSlot slots[MAX_READERS];
+    struct Node* limbo[3];        // Removed nodes, by epoch % 3 (writer only)
+    int retiredSinceAdvance;      // Writer only
+};
+
+/*
+ * SMALL HELPERS FOR THE TAGGED RIGHT POINTER
+ * ------------------------------------------
+ */
+uintptr_t makeChild(struct Node* node) {
+    return (uintptr_t)node;
+}
+
+uintptr_t makeThread(struct Node* node) {
+    return (uintptr_t)node | THREAD_BIT;
+}
+
+struct Node* pointerOf(uintptr_t right) {
+    return (struct Node*)(right & ~THREAD_BIT);
+}
+
+int isThread(uintptr_t right) {
+    return (right & THREAD_BIT) != 0;
+}
+
+// Reader side loads (acquire: see everything written before the link)
+struct Node* readLeft(struct Node* node) {
+    return atomic_load_explicit(&node->left, memory_order_acquire);
+}
+
+uintptr_t readRight(struct Node* node) {
+    return atomic_load_explicit(&node->right, memory_order_acquire);
+}
+
+// Writer side stores (release: publish everything written before)
+void publishLeft(struct Node* node, struct Node* child) {
+    atomic_store_explicit(&node->left, child, memory_order_release);
+}
+
+void publishRight(struct Node* node, uintptr_t right) {
+    atomic_store_explicit(&node->right, right, memory_order_release);
+}
+
+/*
+ * CREATE A NEW NODE
+ * ----------------
+ * Not visible to readers until it is linked in.
+ */
+struct Node* createNode(int value) {
+    struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    newNode->data = value;
+    atomic_init(&newNode->left, NULL);
+    atomic_init(&newNode->right, makeThread(NULL));
+    newNode->retiredNext = NULL;
+    return newNode;
+}
+
+void initTree(struct SharedTree* t) {
+    atomic_init(&t->root, NULL);
+    atomic_init(&t->globalEpoch, 1);
+    for (int i = 0; i < MAX_READERS; i++) {
+        atomic_init(&t->slots[i].epoch, 0);
+    }
+    t->limbo[0] = t->limbo[1] = t->limbo[2] = NULL;
+    t->retiredSinceAdvance = 0;
+}
+
+/*
+ * EPOCHS: READER SIDE
+ * -------------------
+ * The fence makes sure the writer either sees our slot, or we see
+ * every unlink the writer did before it looked at the slots.
+ */
+void readerEnter(struct SharedTree* t, int id) {
+    unsigned long e = atomic_load(&t->globalEpoch);
+    atomic_store(&t->slots[id].epoch, e);
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+void readerExit(struct SharedTree* t, int id) {
+    atomic_store_explicit(&t->slots[id].epoch, 0, memory_order_release);
+}
+
+/*
+ * EPOCHS: WRITER SIDE
+ * -------------------
+ * Moving from epoch e to e+1 is allowed once every active reader is in e.
+ * Those readers started after the move to e, so they cannot reach nodes
+ * removed during e-1: free them.
+ */
+void freeList(struct Node* node) {
+    while (node != NULL) {
+        struct Node* next = node->retiredNext;
+        free(node);
+        node = next;
+    }
+}
+
+void tryAdvanceEpoch(struct SharedTree* t) {
+    unsigned long e = atomic_load(&t->globalEpoch);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    for (int i = 0; i < MAX_READERS; i++) {
+        unsigned long seen = atomic_load(&t->slots[i].epoch);
+        if (seen != 0 && seen != e) {
+            return;  // Someone is still in an older epoch
+        }
+    }
+
+    // (e + 2) % 3 is the list of epoch e-1
+    freeList(t->limbo[(e + 2) % 3]);
+    t->limbo[(e + 2) % 3] = NULL;
+    t->retiredSinceAdvance = 0;
+    atomic_store(&t->globalEpoch, e + 1);
+}
+
+void retireNode(struct SharedTree* t, struct Node* node) {
+    unsigned long e = atomic_load_explicit(&t->globalEpoch, memory_order_relaxed);
+    node->retiredNext = t->limbo[e % 3];
+    t->limbo[e % 3] = node;
+
+    t->retiredSinceAdvance++;
+    if (t->retiredSinceAdvance >= RETIRE_BATCH) {
+        tryAdvanceEpoch(t);
+    }
+}
+
+/*
+ * INORDER SUCCESSOR (READER SIDE)
+ * -------------------------------
+ * Same two cases as threaded_bst.c
+ */
+struct Node* nextInorder(struct Node* node) {
+    uintptr_t right = readRight(node);
+    struct Node* next = pointerOf(right);
+
+    if (isThread(right) || next == NULL) {
+        return next;
+    }
+
+    // Right child: go to its leftmost node
+    struct Node* left = readLeft(next);
+    while (left != NULL) {
+        next = left;
+        left = readLeft(next);
+    }
+    return next;
+}
+
+/*
+ * CONCURRENT INORDER SCAN
+ * -----------------------
+ * Walks the whole tree inside one epoch.
+ * A value that is not larger than the previous one is skipped: this only
+ * happens for a moment during a two-children delete, when the successor's
+ * value exists in both its old and new place.
+ *
+ * Returns the number of values visited.
+ */
+long scanInorder(struct SharedTree* t, int id, long long* sum) {
+    readerEnter(t, id);
+
+    struct Node* node = atomic_load_explicit(&t->root, memory_order_acquire);
+    if (node != NULL) {
+        struct Node* left = readLeft(node);
+        while (left != NULL) {
+            node = left;
+            left = readLeft(node);
+        }
+    }
+
+    long count = 0;
+    long long total = 0;
+    long long last = LLONG_MIN;
+
+    while (node != NULL) {
+        if (node->data > last) {
+            last = node->data;
+            total += node->data;
+            count++;
+        }
+        node = nextInorder(node);
+    }
+
+    readerExit(t, id);
+    *sum = total;
+    return count;
+}
+
+/*
+ * INSERT (WRITER ONLY)
+ * --------------------
+ * Same as threaded_bst.c, but the last step - the link from the parent -
+ * is one release store, so readers see either the old or the new tree.
+ */
+void concurrentInsert(struct SharedTree* t, int value) {
+    struct Node* current = atomic_load_explicit(&t->root, memory_order_relaxed);
+
+    if (current == NULL) {
+        atomic_store_explicit(&t->root, createNode(value), memory_order_release);
+        return;
+    }
+
+    while (1) {
+        if (value < current->data) {
+            struct Node* left = atomic_load_explicit(&current->left, memory_order_relaxed);
+            if (left == NULL) {
+                // New left child: its thread points back to the parent
+                struct Node* newNode = createNode(value);
+                atomic_init(&newNode->right, makeThread(current));
+                publishLeft(current, newNode);
+                return;
+            }
+            current = left;
+        }
+        else if (value > current->data) {
+            uintptr_t right = atomic_load_explicit(&current->right, memory_order_relaxed);
+            if (isThread(right)) {
+                // New right child: inherits the parent's thread
+                struct Node* newNode = createNode(value);
+                atomic_init(&newNode->right, right);
+                publishRight(current, makeChild(newNode));
+                return;
+            }
+            current = pointerOf(right);
+        }
+        else {
+            return;  // Duplicate
+        }
+    }
+}
+
+/*
+ * WRITER HELPERS FOR DELETE
+ * -------------------------
+ */
+
+// Rightmost node of a subtree (its right is always a thread)
+struct Node* rightmost(struct Node* node) {
+    uintptr_t right = atomic_load_explicit(&node->right, memory_order_relaxed);
+    while (!isThread(right)) {
+        node = pointerOf(right);
+        right = atomic_load_explicit(&node->right, memory_order_relaxed);
+    }
+    return node;
+}
+
+// Make parent (or root) point to newChild instead of oldChild
+void replaceChild(struct SharedTree* t, struct Node* parent,
+                  struct Node* oldChild, struct Node* newChild) {
+    if (parent == NULL) {
+        atomic_store_explicit(&t->root, newChild, memory_order_release);
+    }
+    else if (atomic_load_explicit(&parent->left, memory_order_relaxed) == oldChild) {
+        publishLeft(parent, newChild);
+    }
+    else {
+        publishRight(parent, makeChild(newChild));
+    }
+}
+
+/*
+ * UNLINK A NODE WITH AT MOST ONE CHILD
+ * ------------------------------------
+ * Same three cases as removeNode in threaded_bst.c.
+ * The node's own pointers are left alone, so a reader standing on it
+ * still continues to the right place.
+ */
+void unlinkNode(struct SharedTree* t, struct Node* parent, struct Node* node) {
+    struct Node* left = atomic_load_explicit(&node->left, memory_order_relaxed);
+    uintptr_t right = atomic_load_explicit(&node->right, memory_order_relaxed);
+
+    if (left != NULL) {
+        // Only left child: predecessor now threads past the node
+        publishRight(rightmost(left), right);
+        replaceChild(t, parent, node, left);
+    }
+    else if (!isThread(right)) {
+        // Only right child
+        replaceChild(t, parent, node, pointerOf(right));
+    }
+    else if (parent == NULL) {
+        atomic_store_explicit(&t->root, NULL, memory_order_release);
+    }
+    else if (atomic_load_explicit(&parent->left, memory_order_relaxed) == node) {
+        publishLeft(parent, NULL);
+    }
+    else {
+        // Leaf on the right: parent's right becomes a thread again
+        publishRight(parent, right);
+    }
+
+    retireNode(t, node);
+}
+
+/*
+ * DELETE (WRITER ONLY)
+ * --------------------
+ * Two children case, without changing any visible value:
+ *
+ *   1. Build a copy of the node holding the successor's value,
+ *      with the same left and right subtrees
+ *   2. Point the predecessor's thread at the copy
+ *   3. Swap the copy in, in place of the node
+ *   4. Point the old node's right at the copy (for readers still on it)
+ *   5. Unlink the old successor node (it has no left child)
+ */
+void concurrentDelete(struct SharedTree* t, int value) {
+    struct Node* parent = NULL;
+    struct Node* node = atomic_load_explicit(&t->root, memory_order_relaxed);
+
+    // Find the node and its parent
+    while (node != NULL && node->data != value) {
+        parent = node;
+        if (value < node->data) {
+            node = atomic_load_explicit(&node->left, memory_order_relaxed);
+        }
+        else {
+            uintptr_t right = atomic_load_explicit(&node->right, memory_order_relaxed);
+            node = isThread(right) ? NULL : pointerOf(right);
+        }
+    }
+
+    if (node == NULL) {
+        return;  // Value not found
+    }
+
+    struct Node* left = atomic_load_explicit(&node->left, memory_order_relaxed);
+    uintptr_t right = atomic_load_explicit(&node->right, memory_order_relaxed);
+
+    if (left == NULL || isThread(right)) {
+        unlinkNode(t, parent, node);
+        return;
+    }
+
+    // Find the successor (leftmost of right subtree)
+    struct Node* succParent = node;
+    struct Node* succ = pointerOf(right);
+    struct Node* succLeft = atomic_load_explicit(&succ->left, memory_order_relaxed);
+    while (succLeft != NULL) {
+        succParent = succ;
+        succ = succLeft;
+        succLeft = atomic_load_explicit(&succ->left, memory_order_relaxed);
+    }
+    uintptr_t succRight = atomic_load_explicit(&succ->right, memory_order_relaxed);
+
+    // Step 1: the copy (if succ is the direct right child, skip over it)
+    struct Node* copy = createNode(succ->data);
+    atomic_init(&copy->left, left);
+    atomic_init(&copy->right, succParent == node ? succRight : right);
+
+    // Steps 2-4
+    publishRight(rightmost(left), makeThread(copy));
+    replaceChild(t, parent, node, copy);
+    publishRight(node, makeThread(copy));
+
+    // Step 5
+    if (succParent != node) {
+        publishLeft(succParent, isThread(succRight) ? NULL : pointerOf(succRight));
+    }
+
+    retireNode(t, node);
+    retireNode(t, succ);
+}
+
+/*
+ * FREE EVERYTHING (no readers left)
+ * ---------------------------------
+ */
+void freeSubtree(struct Node* node) {
+    if (node == NULL) {
+        return;
+    }
+    freeSubtree(atomic_load(&node->left));
+    uintptr_t right = atomic_load(&node->right);
+    if (!isThread(right)) {
+        freeSubtree(pointerOf(right));
+    }
+    free(node);
+}
+
+void destroyTree(struct SharedTree* t) {
+    for (int i = 0; i < 3; i++) {
+        freeList(t->limbo[i]);
+        t->limbo[i] = NULL;
+    }
+    freeSubtree(atomic_load(&t->root));
+    atomic_store(&t->root, NULL);
+}
+
+/*
+ * BENCHMARK: READER THROUGHPUT WHILE A WRITER IS BUSY
+ * ---------------------------------------------------
+ */
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+struct BenchShared {
+    struct SharedTree* tree;
+    int keyRange;
+    atomic_int stop;
+};
+
+struct ReaderArgs {
+    struct BenchShared* shared;
+    int id;
+    long visited;
+    long scans;
+};
+
+struct WriterArgs {
+    struct BenchShared* shared;
+    long operations;
+};
+
+void* readerThread(void* arg) {
+    struct ReaderArgs* args = (struct ReaderArgs*)arg;
+    long long sum;
+
+    while (!atomic_load_explicit(&args->shared->stop, memory_order_relaxed)) {
+        args->visited += scanInorder(args->shared->tree, args->id, &sum);
+        args->scans++;
+    }
+    return NULL;
+}
+
+// Small private random generator (rand() is shared between threads)
+unsigned int nextRandom(unsigned int* state) {
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+void* writerThread(void* arg) {
+    struct WriterArgs* args = (struct WriterArgs*)arg;
+    unsigned int seed = 12345;  // xorshift state
+
+    // Alternate insert/delete of random keys, so the size stays about the same
+    while (!atomic_load_explicit(&args->shared->stop, memory_order_relaxed)) {
+        concurrentInsert(args->shared->tree, nextRandom(&seed) % args->shared->keyRange);
+        concurrentDelete(args->shared->tree, nextRandom(&seed) % args->shared->keyRange);
+        args->operations += 2;
+    }
+    return NULL;
+}
+
+void runScaling(int treeSize, double seconds, int maxReaders) {
+    struct SharedTree tree;
+    initTree(&tree);
+
+    struct BenchShared shared;
+    shared.tree = &tree;
+    shared.keyRange = treeSize * 2;
+    atomic_init(&shared.stop, 0);
+
+    // Random keys keep the (unbalanced) tree reasonably shallow
+    srand(42);
+    for (int i = 0; i < treeSize; i++) {
+        concurrentInsert(&tree, rand() % shared.keyRange);
+    }
+
+    long long sum;
+    long startSize = scanInorder(&tree, 0, &sum);
+
+    int cores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (maxReaders <= 0) {
+        maxReaders = cores > 1 ? cores - 1 : 1;  // Leave one core for the writer
+    }
+    if (maxReaders > MAX_READERS) {
+        maxReaders = MAX_READERS;
+    }
+
+    printf("Tree size: %ld nodes, %d cores, %.1f s per run\n\n", startSize, cores, seconds);
+    printf("Readers | Scans/s   | Nodes/s (M) | Per reader (M) | Writer ops/s\n");
+    printf("--------+-----------+-------------+----------------+-------------\n");
+
+    int readers = 1;
+    while (1) {
+        struct ReaderArgs readerArgs[MAX_READERS];
+        pthread_t readerIds[MAX_READERS];
+        struct WriterArgs writerArgs = { &shared, 0 };
+        pthread_t writerId;
+
+        atomic_store(&shared.stop, 0);
+        for (int i = 0; i < readers; i++) {
+            readerArgs[i].shared = &shared;
+            readerArgs[i].id = i;
+            readerArgs[i].visited = 0;
+            readerArgs[i].scans = 0;
+        }
+
+        double start = nowSeconds();
+        pthread_create(&writerId, NULL, writerThread, &writerArgs);
+        for (int i = 0; i < readers; i++) {
+            pthread_create(&readerIds[i], NULL, readerThread, &readerArgs[i]);
+        }
+
+        struct timespec pause = { (time_t)seconds, (long)((seconds - (time_t)seconds) * 1e9) };
+        nanosleep(&pause, NULL);
+        atomic_store(&shared.stop, 1);
+
+        for (int i = 0; i < readers; i++) {
+            pthread_join(readerIds[i], NULL);
+        }
+        pthread_join(writerId, NULL);
+        double elapsed = nowSeconds() - start;
+
+        long totalVisited = 0;
+        long totalScans = 0;
+        for (int i = 0; i < readers; i++) {
+            totalVisited += readerArgs[i].visited;
+            totalScans += readerArgs[i].scans;
+        }
+
+        printf("%7d | %9.1f | %11.2f | %14.2f | %11.0f\n",
+               readers,
+               totalScans / elapsed,
+               totalVisited / elapsed / 1e6,
+               totalVisited / elapsed / 1e6 / readers,
+               writerArgs.operations / elapsed);
+
+        if (readers == maxReaders) {
+            break;
+        }
+        readers = readers * 2 < maxReaders ? readers * 2 : maxReaders;
+    }
+
+    destroyTree(&tree);
+}
+
+/*
+ * MAIN FUNCTION - DEMO + SCALING BENCHMARK
+ * ----------------------------------------
+ */
+int main(int argc, char* argv[]) {
+    int treeSize = argc > 1 ? atoi(argv[1]) : 200000;
+    double seconds = argc > 2 ? atof(argv[2]) : 1.0;
+    int maxReaders = argc > 3 ? atoi(argv[3]) : 0;  // 0 = one per spare core
+
+    printf("=== THREADED BST: LOCK-FREE READERS + ONE WRITER ===\n\n");
+
+    // Small single-threaded demo first
+    struct SharedTree tree;
+    initTree(&tree);
+
+    printf("Inserting values: 20, 10, 30, 5, 15, 25, 35\n");
+    int values[] = {20, 10, 30, 5, 15, 25, 35};
+    for (int i = 0; i < 7; i++) {
+        concurrentInsert(&tree, values[i]);
+    }
+
+    printf("Deleting 20 (two children, root) and 5 (leaf)\n");
+    concurrentDelete(&tree, 20);
+    concurrentDelete(&tree, 5);
+
+    printf("Inorder using threads: ");
+    readerEnter(&tree, 0);
+    struct Node* node = atomic_load(&tree.root);
+    while (node != NULL && atomic_load(&node->left) != NULL) {
+        node = atomic_load(&node->left);
+    }
+    while (node != NULL) {
+        printf("%d ", node->data);
+        node = nextInorder(node);
+    }
+    readerExit(&tree, 0);
+    destroyTree(&tree);
+
+    // Scaling benchmark
+    printf("\n\nReader throughput while the writer inserts/deletes non-stop:\n");
+    runScaling(treeSize, seconds, maxReaders);
+
+    printf("\n");
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <stdlib.h>
+#include "skiplist_common.h"
+
+#define POOL_BLOCK 65536
+
+void skipPoolInit(SkipNodePool* p, size_t baseSize, size_t levelSize) {
+    p->baseSize = baseSize;
+    p->levelSize = levelSize;
+    for (int i = 0; i < SKIP_POOL_LEVELS; i++) {
+        p->freeList[i] = NULL;
+        p->next[i] = p->end[i] = NULL;
+    }
+    p->blocks = NULL;
+}
+
+void* skipPoolAlloc(SkipNodePool* p, int level) {
+    // Round up so every node in a block stays pointer aligned
+    size_t size = p->baseSize + p->levelSize * (level + 1);
+    size = (size + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*);
+
+    if (p->freeList[level]) {
+        void* node = p->freeList[level];
+        p->freeList[level] = *(void**)node;
+        return node;
+    }
+    if (p->next[level] == NULL || (size_t)(p->end[level] - p->next[level]) < size) {
+        char* block = malloc(POOL_BLOCK);
+        if (!block)
+            return NULL;
+        *(void**)block = p->blocks;
+        p->blocks = block;
+        p->next[level] = block + sizeof(void*);
+        p->end[level] = block + POOL_BLOCK;
+    }
+    void* node = p->next[level];
+    p->next[level] += size;
+    return node;
+}
+
+// The node's first word holds the free list link until it is reused
+void skipPoolFree(SkipNodePool* p, void* node, int level) {
+    *(void**)node = p->freeList[level];
+    p->freeList[level] = node;
+}
+
+void skipPoolDestroy(SkipNodePool* p) {
+    while (p->blocks) {
+        void* next = *(void**)p->blocks;
+        free(p->blocks);
+        p->blocks = next;
+    }
+    skipPoolInit(p, p->baseSize, p->levelSize);
+}
+
+// One random draw gives the whole level: bit i is coin flip i, so the
+// level is the number of trailing zero bits. With shift bits per coin
+// flip a level needs shift zero bits, so P = 1/2^shift. The state is per
+// thread; rand() takes a global lock in glibc.
+static _Thread_local unsigned int levelSeed = 0;
+
+int skipRandomLevel(int maxLevel, int shift) {
+    if (levelSeed == 0)
+        levelSeed = 2463534242u ^ (unsigned int)(size_t)&levelSeed;
+    levelSeed ^= levelSeed << 13;
+    levelSeed ^= levelSeed >> 17;
+    levelSeed ^= levelSeed << 5;
+    int level = __builtin_ctz(levelSeed | (1u << 31)) / shift;
+    return level < maxLevel ? level : maxLevel;
+}
@@ -0,0 +1,38 @@
+#ifndef SKIPLIST_COMMON_H
+#define SKIPLIST_COMMON_H
+
+#include <stddef.h>
+
+// Pieces shared by the skip list programs in Unit_1 (skiplist_operations.c,
+// concurrent_skiplist.c, indexable_skiplist.c, skiplist_layout_bench.c,
+// skiplist_level_bench.c) and Orange Problem Prep/circ_skip.c. From either folder:
+//     #include "../common/skiplist_common.h"
+//     gcc yourfile.c ../common/skiplist_common.c
+//
+// Node pool for skip lists whose forward[] array is stored inside the
+// node: one size class per level count. levelSize is the size of one
+// entry of that array (a forward pointer, or a pointer plus a span). Nodes are carved out of big
+// blocks, and a freed node is reused by the next node of the same size.
+// The pool remembers its blocks, so destroying a list is one call.
+
+#define SKIP_POOL_LEVELS 33     // levels 0 .. 32
+
+typedef struct {
+    size_t baseSize;                        // node size without forward pointers
+    size_t levelSize;                       // bytes per level entry
+    void* freeList[SKIP_POOL_LEVELS];
+    char* next[SKIP_POOL_LEVELS];           // free space of the current block
+    char* end[SKIP_POOL_LEVELS];
+    void* blocks;                           // every block, chained through its first word
+} SkipNodePool;
+
+void skipPoolInit(SkipNodePool* p, size_t baseSize, size_t levelSize);
+void* skipPoolAlloc(SkipNodePool* p, int level);        // level+1 level entries, NULL if out of memory
+void skipPoolFree(SkipNodePool* p, void* node, int level);
+void skipPoolDestroy(SkipNodePool* p);                  // frees every node at once
+
+// Random level 0 .. maxLevel (maxLevel <= 31) with P = 1/2^shift per
+// level: shift 1 gives P = 0.5, shift 2 gives P = 0.25 (Redis)
+int skipRandomLevel(int maxLevel, int shift);
+
+#endif
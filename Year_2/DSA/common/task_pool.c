@@ -0,0 +1,192 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include "task_pool.h"
+#include "ws_deque.h"
+
+// The per-worker deques are lock-free: the owner never takes a lock to
+// spawn or pop, which is what happens millions of times; only steals
+// use a CAS.
+
+typedef struct {
+    WsDeque deque;
+    struct TaskPool* pool;  // so a new thread knows where it belongs
+    int index;
+    char padding[CACHE_LINE];
+} Worker;
+
+struct TaskPool {
+    int workers;
+    Worker* slots;
+    pthread_t* threads;
+
+    // Workers sleep on this while no parallel job is running
+    pthread_mutex_t sleepLock;
+    pthread_cond_t wakeUp;
+    atomic_int jobRunning;
+    atomic_int stop;
+
+    atomic_long steals;
+};
+
+// The pool the current thread works for, and which worker it is there
+// (0 = the thread that called poolRun). Tasks only call taskSpawn and
+// taskSync, so these say which deque to use.
+static _Thread_local TaskPool* myPool = NULL;
+static _Thread_local int myWorker = 0;
+static _Thread_local unsigned int randomState = 1;
+
+static unsigned int nextRandom(void) {
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+void taskInit(Task* task, void (*function)(void*), void* arg) {
+    task->function = function;
+    task->arg = arg;
+    atomic_init(&task->done, 0);
+}
+
+static void runTask(Task* task) {
+    task->function(task->arg);
+    atomic_store_explicit(&task->done, 1, memory_order_release);
+}
+
+void taskSpawn(Task* task) {
+    wsPush(&myPool->slots[myWorker].deque, task);
+}
+
+// Take the oldest task of a random other worker
+static Task* steal(TaskPool* pool) {
+    if (pool->workers < 2)
+        return NULL;
+    int victim = nextRandom() % (pool->workers - 1);
+    if (victim >= myWorker)
+        victim++;
+    Task* task = wsSteal(&pool->slots[victim].deque);
+    if (task)
+        atomic_fetch_add_explicit(&pool->steals, 1, memory_order_relaxed);
+    return task;
+}
+
+void taskSync(Task* task) {
+    TaskPool* pool = myPool;
+    while (!atomic_load_explicit(&task->done, memory_order_acquire)) {
+        // Usually the task is still on my deque and nobody stole it
+        Task* next = wsPop(&pool->slots[myWorker].deque);
+        if (!next)
+            next = steal(pool);
+        if (next)
+            runTask(next);
+        else
+            sched_yield();
+    }
+}
+
+static void* workerLoop(void* arg) {
+    Worker* me = arg;
+    TaskPool* pool = me->pool;
+    myPool = pool;
+    myWorker = me->index;
+    randomState = 2654435761u * (myWorker + 1);
+
+    while (1) {
+        // Only take the lock when there is nothing to do
+        if (!atomic_load(&pool->jobRunning)) {
+            pthread_mutex_lock(&pool->sleepLock);
+            while (!atomic_load(&pool->jobRunning) && !atomic_load(&pool->stop))
+                pthread_cond_wait(&pool->wakeUp, &pool->sleepLock);
+            pthread_mutex_unlock(&pool->sleepLock);
+        }
+        if (atomic_load(&pool->stop))
+            break;
+
+        Task* task = wsPop(&pool->slots[myWorker].deque);
+        if (!task)
+            task = steal(pool);
+        if (task)
+            runTask(task);
+        else
+            sched_yield();
+    }
+    return NULL;
+}
+
+TaskPool* poolCreate(int workers) {
+    if (workers < 1)
+        workers = 1;
+    TaskPool* pool = malloc(sizeof(TaskPool));
+    if (!pool)
+        return NULL;
+    pool->workers = workers;
+    pool->slots = aligned_alloc(CACHE_LINE, workers * sizeof(Worker));
+    pool->threads = malloc(workers * sizeof(pthread_t));
+    if (!pool->slots || !pool->threads) {
+        free(pool->slots);
+        free(pool->threads);
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->sleepLock, NULL);
+    pthread_cond_init(&pool->wakeUp, NULL);
+    atomic_init(&pool->jobRunning, 0);
+    atomic_init(&pool->stop, 0);
+    atomic_init(&pool->steals, 0);
+    for (int i = 0; i < workers; i++) {
+        wsInit(&pool->slots[i].deque, 256);
+        pool->slots[i].pool = pool;
+        pool->slots[i].index = i;
+    }
+
+    // Worker 0 is the caller of poolRun, so only start workers 1..N-1
+    for (int i = 1; i < workers; i++)
+        pthread_create(&pool->threads[i], NULL, workerLoop, &pool->slots[i]);
+    return pool;
+}
+
+// Run one parallel job; the calling thread joins in as worker 0
+void poolRun(TaskPool* pool, void (*function)(void*), void* arg) {
+    TaskPool* outerPool = myPool;
+    int outerWorker = myWorker;
+    myPool = pool;
+    myWorker = 0;
+    randomState = 2654435761u;
+
+    pthread_mutex_lock(&pool->sleepLock);
+    atomic_store(&pool->jobRunning, 1);
+    pthread_cond_broadcast(&pool->wakeUp);
+    pthread_mutex_unlock(&pool->sleepLock);
+
+    function(arg);
+
+    atomic_store(&pool->jobRunning, 0);
+    myPool = outerPool;
+    myWorker = outerWorker;
+}
+
+void poolDestroy(TaskPool* pool) {
+    pthread_mutex_lock(&pool->sleepLock);
+    atomic_store(&pool->stop, 1);
+    pthread_cond_broadcast(&pool->wakeUp);
+    pthread_mutex_unlock(&pool->sleepLock);
+
+    for (int i = 1; i < pool->workers; i++)
+        pthread_join(pool->threads[i], NULL);
+    for (int i = 0; i < pool->workers; i++)
+        wsFree(&pool->slots[i].deque);
+    pthread_mutex_destroy(&pool->sleepLock);
+    pthread_cond_destroy(&pool->wakeUp);
+    free(pool->slots);
+    free(pool->threads);
+    free(pool);
+}
+
+int poolWorkers(const TaskPool* pool) {
+    return pool->workers;
+}
+
+long poolSteals(TaskPool* pool) {
+    return atomic_load(&pool->steals);
+}
@@ -0,0 +1,44 @@
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#include <stdatomic.h>
+
+// Fork-join thread pool on Chase-Lev deques (ws_deque.c), used by
+// Unit_1/task_pool_bench.c and Unit_3/parallel_tree_tasks.c.
+// Each worker pushes the tasks it spawns on its own deque; idle workers
+// steal the oldest task of a random other worker.
+//
+//   TaskPool* pool = poolCreate(4);
+//   poolRun(pool, rootFunction, arg);   // caller joins in as worker 0
+//   poolDestroy(pool);
+//
+// Inside a task (it runs on the pool that poolRun was called on):
+//   Task t; taskInit(&t, f, arg); taskSpawn(&t);
+//   ... do other work ...
+//   taskSync(&t);                 // runs other tasks while it waits
+// A task may live on the spawner's stack because it is always synced
+// before that function returns.
+//
+// From either folder:
+//     #include "../common/task_pool.h"
+//     gcc -pthread yourfile.c ../common/task_pool.c ../common/ws_deque.c
+
+typedef struct {
+    void (*function)(void* arg);
+    void* arg;
+    atomic_int done;
+} Task;
+
+typedef struct TaskPool TaskPool;
+
+TaskPool* poolCreate(int workers);      // NULL if out of memory
+void poolRun(TaskPool* pool, void (*function)(void*), void* arg);
+void poolDestroy(TaskPool* pool);
+int poolWorkers(const TaskPool* pool);
+long poolSteals(TaskPool* pool);        // successful steals since poolCreate
+
+void taskInit(Task* task, void (*function)(void*), void* arg);
+void taskSpawn(Task* task);
+void taskSync(Task* task);
+
+#endif
@@ -0,0 +1,96 @@
+#include <stdlib.h>
+#include "ws_deque.h"
+
+// Items are at positions top .. bottom-1 (slot = position & (size-1)).
+// Memory orders follow Le, Pop, Cohen and Zappa Nardelli, "Correct and
+// Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+
+static WsArray* newArray(long size) {
+    WsArray* a = malloc(sizeof(WsArray) + size * sizeof(_Atomic(void*)));
+    a->size = size;
+    a->previous = NULL;
+    return a;
+}
+
+void wsInit(WsDeque* q, long capacity) {
+    long size = 2;
+    while (size < capacity)
+        size *= 2;
+    atomic_init(&q->top, 0);
+    atomic_init(&q->bottom, 0);
+    atomic_init(&q->array, newArray(size));
+}
+
+void wsFree(WsDeque* q) {
+    WsArray* a = atomic_load(&q->array);
+    while (a) {
+        WsArray* previous = a->previous;
+        free(a);
+        a = previous;
+    }
+    atomic_store(&q->array, NULL);
+}
+
+// Copy the live items into an array twice as big
+static WsArray* grow(WsDeque* q, WsArray* a, long top, long bottom) {
+    WsArray* bigger = newArray(a->size * 2);
+    for (long i = top; i < bottom; i++) {
+        void* item = atomic_load_explicit(&a->items[i & (a->size - 1)], memory_order_relaxed);
+        atomic_store_explicit(&bigger->items[i & (bigger->size - 1)], item, memory_order_relaxed);
+    }
+    bigger->previous = a;
+    atomic_store_explicit(&q->array, bigger, memory_order_release);
+    return bigger;
+}
+
+void wsPush(WsDeque* q, void* item) {
+    long b = atomic_load_explicit(&q->bottom, memory_order_relaxed);
+    long t = atomic_load_explicit(&q->top, memory_order_acquire);
+    WsArray* a = atomic_load_explicit(&q->array, memory_order_relaxed);
+    if (b - t > a->size - 1)
+        a = grow(q, a, t, b);
+    // Release on the slot as well as the fence: same cost on x86, and
+    // thread sanitizers (which ignore fences) then see the hand-off too
+    atomic_store_explicit(&a->items[b & (a->size - 1)], item, memory_order_release);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&q->bottom, b + 1, memory_order_relaxed);
+}
+
+void* wsPop(WsDeque* q) {
+    // Claim the bottom item first, then look at top
+    long b = atomic_load_explicit(&q->bottom, memory_order_relaxed) - 1;
+    WsArray* a = atomic_load_explicit(&q->array, memory_order_relaxed);
+    atomic_store_explicit(&q->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long t = atomic_load_explicit(&q->top, memory_order_relaxed);
+
+    if (t > b) {
+        // Was already empty
+        atomic_store_explicit(&q->bottom, b + 1, memory_order_relaxed);
+        return NULL;
+    }
+    void* item = atomic_load_explicit(&a->items[b & (a->size - 1)], memory_order_relaxed);
+    if (t == b) {
+        // Last item: race the thieves for it
+        if (!atomic_compare_exchange_strong_explicit(&q->top, &t, t + 1,
+                memory_order_seq_cst, memory_order_relaxed))
+            item = NULL;
+        atomic_store_explicit(&q->bottom, b + 1, memory_order_relaxed);
+    }
+    return item;
+}
+
+void* wsSteal(WsDeque* q) {
+    long t = atomic_load_explicit(&q->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long b = atomic_load_explicit(&q->bottom, memory_order_acquire);
+    if (t >= b)
+        return NULL;
+
+    WsArray* a = atomic_load_explicit(&q->array, memory_order_acquire);
+    void* item = atomic_load_explicit(&a->items[t & (a->size - 1)], memory_order_acquire);
+    if (!atomic_compare_exchange_strong_explicit(&q->top, &t, t + 1,
+            memory_order_seq_cst, memory_order_relaxed))
+        return NULL;    // The owner or another thief took it
+    return item;
+}
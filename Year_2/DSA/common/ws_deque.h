@@ -0,0 +1,36 @@
+#ifndef WS_DEQUE_H
+#define WS_DEQUE_H
+
+#include <stdatomic.h>
+
+// Chase-Lev work-stealing deque of pointers (no locks).
+// - ONE owner thread uses wsPush / wsPop at the BOTTOM (newest item)
+// - any number of thieves use wsSteal at the TOP (oldest item)
+// The owner and thieves only compete when one item is left; then a
+// compare-and-swap on top decides who gets it.
+// The array grows when full. Old arrays are kept until wsFree because a
+// slow thief may still be reading one.
+
+#ifndef CACHE_LINE
+#define CACHE_LINE 64
+#endif
+
+typedef struct WsArray {
+    long size;                      // power of two
+    struct WsArray* previous;       // older, smaller array (freed in wsFree)
+    _Atomic(void*) items[];
+} WsArray;
+
+typedef struct {
+    _Alignas(CACHE_LINE) atomic_long top;           // thieves
+    _Alignas(CACHE_LINE) atomic_long bottom;        // owner
+    _Atomic(WsArray*) array;
+} WsDeque;
+
+void wsInit(WsDeque* q, long capacity);
+void wsFree(WsDeque* q);
+void wsPush(WsDeque* q, void* item);    // owner only
+void* wsPop(WsDeque* q);                // owner only, NULL if empty
+void* wsSteal(WsDeque* q);              // any thread, NULL if empty or another thread won
+
+#endif